@@ -56,6 +56,13 @@ win64 {
 SOURCES += \
     Inputs/InputSwitchHandler.cpp \
     Inputs/InputWorker.cpp \
+    Inputs/axiscoalescer.cpp \
+    Inputs/axisfilter.cpp \
+    Inputs/encoderaggregator.cpp \
+    Inputs/inputaxes.cpp \
+    Inputs/inputcommand.cpp \
+    Inputs/inputqueue.cpp \
+    Inputs/inputreader.cpp \
     Inputs/inputenum.cpp \
     Inputs/inputmapper.cpp \
     dual/dualworker.cpp \
@@ -69,8 +76,11 @@ SOURCES += \
     outputs/outputbundle.cpp \
     outputs/outputenum.cpp \
     outputs/outputhandler.cpp \
+    outputs/outputlineformatter.cpp \
     outputs/outputmapper.cpp \
+    outputs/outputrouter.cpp \
     outputs/outputworker.cpp \
+    outputs/outputwriters.cpp \
     outputs/set.cpp \
     outputs/sethandler.cpp \
     settings/calibrateaxismenu.cpp \
@@ -81,7 +91,15 @@ SOURCES += \
     settings/settingshandler.cpp \
     settings/settingsranges.cpp \
     sources/Engine.cpp \
+    sources/PortReconnector.cpp \
+    sources/SerialLineFramer.cpp \
     sources/SerialPort.cpp \
+    sources/SerialPortOpener.cpp \
+    sources/SerialPortPosix.cpp \
+    sources/SerialPortSettings.cpp \
+    sources/SimConnectHub.cpp \
+    sources/SimConnectReconnector.cpp \
+    sources/WakeEvent.cpp \
     sources/main.cpp \
     sources/mainwindow.cpp \
     sources/range.cpp \
@@ -90,6 +108,15 @@ HEADERS += \
     Inputs/InputMapper.h \
     Inputs/InputSwitchHandler.h \
     Inputs/InputWorker.h \
+    Inputs/axiscoalescer.h \
+    Inputs/axiscurve.h \
+    Inputs/axisfilter.h \
+    Inputs/encoderaggregator.h \
+    Inputs/inputaxes.h \
+    Inputs/inputcommand.h \
+    Inputs/inputdispatchtable.h \
+    Inputs/inputqueue.h \
+    Inputs/inputreader.h \
     Inputs/inputenum.h \
     dual/dualworker.h \
     elements/mcheckbox.h \
@@ -98,8 +125,14 @@ HEADERS += \
     headers/Engine.h \
     headers/constants.h \
     headers/mainwindow.h \
+    headers/PortReconnector.h \
+    headers/SerialLineFramer.h \
     headers/SerialPort.hpp \
+    headers/SerialPortOpener.h \
     headers/SimConnect.h \
+    headers/SimConnectHub.h \
+    headers/SimConnectReconnector.h \
+    headers/WakeEvent.h \
     headers/range.h \
     library/librarygenerator.h \
     library/librarygeneratorwidget.h \
@@ -109,8 +142,12 @@ HEADERS += \
     outputs/outputbundle.h \
     outputs/outputenum.h \
     outputs/outputhandler.h \
+    outputs/outputlineformatter.h \
     outputs/outputmapper.h \
+    outputs/outputrouter.h \
+    outputs/outputschedule.h \
     outputs/outputworker.h \
+    outputs/outputwriters.h \
     outputs/set.h \
     outputs/sethandler.h \
     settings/calibrateaxismenu.h \
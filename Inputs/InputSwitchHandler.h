@@ -5,6 +5,12 @@
 #include <headers/SimConnect.h>
 #include <headers/constants.h>
 #include <headers/range.h>
+#include <Inputs/axiscoalescer.h>
+#include <Inputs/axiscurve.h>
+#include <Inputs/axisfilter.h>
+#include <Inputs/encoderaggregator.h>
+#include <Inputs/inputaxes.h>
+#include <Inputs/inputcommand.h>
 #include <qmutex.h>
 #include <qsettings.h>
 #include <qstandardpaths.h>
@@ -18,6 +24,7 @@
 #include <QThread>
 #include <cstdio>
 #include <string>
+#include <string_view>
 
 using namespace std;
 
@@ -25,36 +32,47 @@ class InputSwitchHandler {
  public:
   InputSwitchHandler();
 
-  void switchHandling(int index);
+  void switchHandling(std::string_view line);
+
+  // Runs a command that was already parsed, e.g. by an input reader thread
+  void handleCommand(const InputCommand &command);
 
-  char receivedString[10][255];
   HANDLE connect;
   SIMCONNECT_OBJECT_ID object;
   std::array<Engine, constants::supportedEngines> enginelist;
-  Range mixtureRanges[constants::supportedMixtureLevers];
-  Range propellerRanges[constants::supportedPropellerLevers];
-  Range flapsRange;
 
   void setCurve(QList<coordinates> curve, int index);
 
-  float reverseAxis = -23000.0;
- private slots:
-  SettingsHandler settingsHandler;
+  // Analog axes and encoder detents are collected here and only sent when
+  // the worker flushes
+  AxisCoalescer axes;
+  EncoderAggregator encoders;
+
+  // Sends the collected axes and encoders that are due
+  void flushInputs();
 
-  void set_throttle_values(int index);
+  // How long the worker may wait for serial data before flushing again
+  unsigned long msUntilFlush(unsigned long maxWaitMs) const;
 
-  void setMixtureValues(int index);
+  // Called once connected to the sim
+  void resetInputs();
 
-  void set_prop_values(int index);
+  float reverseAxis = -23000.0;
+ private slots:
+  SettingsHandler settingsHandler;
 
-  int setComs(int index, int comNo);
+  int setComs(int value, int comNo);
 
   void sendBasicCommandOn(SIMCONNECT_CLIENT_EVENT_ID eventID);
 
   void sendBasicCommandOff(SIMCONNECT_CLIENT_EVENT_ID eventID);
 
  private:
-  std::string prefix;
+  // Filters, calibrates and queues the analog axes on axes
+  InputAxes axisInputs{&axes};
+
+  void loadAxisFilters();
+
   QList<coordinates> defaultCurve = {
       {coordinates(0, -16383)},  {coordinates(250, -10000)},
       {coordinates(500, 0)},     {coordinates(511, 0)},
@@ -66,37 +84,16 @@ class InputSwitchHandler {
                                      << rudderCurve << brakeCurve
                                      << aileronCurve << elevatorCurve;
   QStringList curveStrings = {"Rudder", "Toe brakes", "Aileron", "Elevator"};
-  int calibratedRange(int value, QList<coordinates> curve);
 
-  void setElevatorTrim(int index);
+  void bakeCurve(int index);
 
-  void setFlaps(int index);
-
-  void setRudder(int index);
-
-  void setBrakeAxis(int index);
+  void bakeThrottleTables();
 
   void sendBasicCommandValue(SIMCONNECT_CLIENT_EVENT_ID eventID, int value);
 
-  void controlYoke(int index);
-
-  void sendBasicCommand(SIMCONNECT_CLIENT_EVENT_ID eventID, int index);
-
-  int mapThrottleValueToAxis(int value, float reverse, float max,
-                             int idleCutoff);
-
-  int mapCoordinates(coordinates toMap);
-
-  int mapCoordinates(coordinates toMapMin, coordinates toMapMax);
-
-  int mapCoordinates(int value, coordinates toMapMin, coordinates toMapMax);
-
-  void sendWASMCommand(SIMCONNECT_CLIENT_EVENT_ID eventID, int index);
+  void sendBasicCommand(SIMCONNECT_CLIENT_EVENT_ID eventID);
 
   void sendWASMCommand(int index, int value);
-
-  int calibratedRange(int value, QList<coordinates> *curve);
-  int calibratedRange(int value, int index);
 };
 
 #endif  // INPUTSWITCHHANDLER_H
@@ -4,9 +4,11 @@
 #include <headers/constants.h>
 #include <qsettings.h>
 
+#include <chrono>
 #include <cstdio>
 #include <future>
 #include <headers/SerialPort.hpp>
+#include <headers/SerialPortOpener.h>
 #include <iostream>
 #include <string>
 
@@ -16,11 +18,6 @@
 #define Bcd2Dec(BcdNum) HornerScheme(BcdNum, 0x10, 10)
 #define Dec2Bcd(DecNum) HornerScheme(DecNum, 10, 0x10)
 
-#define DATA_LENGTH 255
-
-// Declare a global object
-SerialPort *arduinoInput[10];
-
 HANDLE hInputSimConnect;
 //
 
@@ -48,6 +45,18 @@ void InputWorker::MyDispatchProcInput(SIMCONNECT_RECV *pData, DWORD cbData,
       // quit = 1;
       break;
     }
+    case SIMCONNECT_RECV_ID_EVENT_FRAME: {
+      static_cast<InputWorker *>(pContext)->handler.axes.frameTick();
+      break;
+    }
+    case SIMCONNECT_RECV_ID_SIMOBJECT_DATA: {
+      auto *pObjData = (SIMCONNECT_RECV_SIMOBJECT_DATA *)pData;
+      if (pObjData->dwRequestID == EncoderAggregator::requestID) {
+        static_cast<InputWorker *>(pContext)->handler.encoders.receiveValues(
+            pObjData, EncoderAggregator::Clock::now());
+      }
+      break;
+    }
     case SIMCONNECT_RECV_ID_CLIENT_DATA: {
       // Cast incoming data into interpretable format for this event.
       auto *pObjData = (SIMCONNECT_RECV_CLIENT_DATA *)pData;
@@ -77,12 +86,22 @@ void InputWorker::sendWASMCommand(char cmd) {
   //      connect, object, 2, index, SIMCONNECT_GROUP_PRIORITY_HIGHEST,
   //      SIMCONNECT_EVENT_FLAG_GROUPID_IS_PRIORITY);
 
-  SimConnect_SetClientData(hInputSimConnect, 1, 12,
+  if (hubSubscriber < 0) {
+    return;
+  }
+  // Called from the UI thread as well, the hub keeps it from interleaving
+  // with the worker's own calls
+  auto session = SimConnectHub::instance().lock(hubSubscriber);
+  if (!session.valid()) {
+    return;
+  }
+  SimConnect_SetClientData(session.handle(),
+                           SimConnectHub::sharedClientDataID,
+                           SimConnectHub::commandDefinitionID,
                            SIMCONNECT_CLIENT_DATA_SET_FLAG_DEFAULT, 0, 256,
                            &arrayTest);
 }
 void InputWorker::inputEvents() {
-  HRESULT hr;
   abortInput = false;
   for (int i = 0; i < curveStrings.size(); i++) {
     auto rudderCurveList = new QList<coordinates>();
@@ -108,90 +127,115 @@ void InputWorker::inputEvents() {
     }
   }
   keys = *settingsHandler.retrieveKeys("runningInputComs");
-  int keySize = keys.size();
-  int succesfullConnected = 0;
-  for (int i = 0; i < keySize; i++) {
-    const char *savedPort;
-    savedPort = settingsHandler.retrieveSetting("runningInputComs", keys[i])
-                    ->toString()
-                    .toStdString()
-                    .c_str();
-
-    arduinoInput[i] = new SerialPort(savedPort);
-    if (arduinoInput[i]->isConnected()) {
+  std::vector<std::string> portNames;
+  for (const auto &key : keys) {
+    portNames.push_back(
+        settingsHandler.retrieveSetting("runningInputComs", key)
+            ->toString()
+            .toStdString());
+  }
+  closePorts();
+  ports = openSerialPorts(portNames);
+  for (size_t i = 0; i < ports.size(); i++) {
+    if (ports[i]->isConnected()) {
       emit(BoardConnectionMade(1, 1));
-      succesfullConnected++;
     }
-    std::cout << i << "Is connected: " << arduinoInput[i]->isConnected()
+    std::cout << i << "Is connected: " << ports[i]->isConnected()
               << std::endl;
   }
-  if (succesfullConnected == keySize) {
+  if (handshakeSerialPorts(ports)) {
     emit(BoardConnectionMade(2, 1));
   }
 
-  while (!abortInput) {
-    emit(GameConnectionMade(1, 1));
-    if (SUCCEEDED(SimConnect_Open(&hInputSimConnect, "incSimConnect", NULL, 0,
-                                  0, 0))) {
-      emit(GameConnectionMade(2, 1));
-      printf("\nConnected to Flight Simulator!");
-
-      SimConnect_MapClientDataNameToID(hInputSimConnect, "shared",
-                                       ClientDataID);
-      hr = SimConnect_CreateClientData(
-          hInputSimConnect, ClientDataID, 4096,
-          SIMCONNECT_CREATE_CLIENT_DATA_FLAG_DEFAULT);
-
-      SimConnect_AddToClientDataDefinition(
-          hInputSimConnect, 12, SIMCONNECT_CLIENTDATAOFFSET_AUTO, 256, 0);
-
-      cout << "CLIENTDATA: " << hr << endl;
-
-      //      hr = SimConnect_MapClientEventToSimEvent(hInputSimConnect,
-      //      EVENT_WASM,
-      //                                               "LVAR_ACCESS.EFIS");
-
-      cout << "MAPCTOE: " << hr << endl;
+  auto &hub = SimConnectHub::instance();
+  SimConnectHub::Routes routes;
+  routes.events = {{0, InputEnum::EVENT_AXIS_FRAME}};
+  routes.objectData = {
+      {EncoderAggregator::requestID, EncoderAggregator::requestID}};
+  hubSubscriber = hub.subscribe(MyDispatchProcInput, this, routes);
+
+  emit(GameConnectionMade(1, 1));
+  // Every pass is one session with the sim. The hub maps the events once
+  // per session, the worker only sets up its own state.
+  while (hub.connect(hubSubscriber, abortInput)) {
+    {
+      auto session = hub.lock(hubSubscriber);
+      if (!session.valid()) {
+        continue;
+      }
+      hInputSimConnect = session.handle();
       handler.connect = hInputSimConnect;
-
       handler.object = objectID;
-      mapper.mapEvents(hInputSimConnect);
-
-      connected = true;
-      sendWASMCommand('8');
-      while (!abortInput && connected) {
-        for (int i = 0; i < keys.size(); i++) {
-          const auto hasRead = arduinoInput[i]->readSerialPort(
-              handler.receivedString[i], DATA_LENGTH);
-
-          if (hasRead) {
-            if (connected) {
-              handler.switchHandling(i);
-            }
-            // lastVal = handler.receivedString[i];
-          }
-
-          // emit updateLastValUI(QString::fromStdString(lastVal));
+      handler.resetInputs();
+    }
+    emit(GameConnectionMade(2, 1));
+    printf("\nConnected to Flight Simulator!");
+
+    connected = true;
+    sendWASMCommand('8');
+    // The boards are read on their own threads, this thread only drains
+    // the queue into SimConnect
+    readers.start(ports);
+    auto lastReport = std::chrono::steady_clock::now();
+    int disconnectedPorts = readers.disconnectedPorts();
+    const auto wakeHandles = hub.wakeHandles(hubSubscriber);
+    while (!abortInput && connected) {
+      // Input records and SimConnect messages both wake the loop right
+      // away, the timeout only covers pending axes
+      inputQueue.waitForRecords(
+          handler.msUntilFlush(constants::serialWaitTimeoutMs),
+          wakeHandles.data(), wakeHandles.size());
+      readers.sampleDepth(inputQueue.depth());
+      if (!hub.dispatch(hubSubscriber)) {
+        connected = false;
+      }
+      {
+        auto session = hub.lock(hubSubscriber);
+        InputRecord record;
+        while (connected && session.valid() && inputQueue.pop(&record)) {
+          handler.handleCommand(record.command);
+        }
+        if (session.valid()) {
+          handler.flushInputs();
         }
-        std::this_thread::sleep_for(std::chrono::milliseconds(10));
       }
 
-      if (connected) {
-        connected = false;
+      if (readers.disconnectedPorts() != disconnectedPorts) {
+        disconnectedPorts = readers.disconnectedPorts();
+        emit(BoardConnectionMade(disconnectedPorts == 0 ? 2 : 1, 1));
       }
-    }
-  }
 
-  SimConnect_Close(hInputSimConnect);
-  for (int i = 0; i < keys.size(); i++) {
-    if (arduinoInput[i]->isConnected()) {
-      arduinoInput[i]->closeSerial();
+      const auto now = std::chrono::steady_clock::now();
+      if (now - lastReport >=
+          std::chrono::milliseconds(constants::inputStatsIntervalMs)) {
+        readers.report(std::chrono::duration<double>(now - lastReport).count());
+        lastReport = now;
+      }
+    }
+    readers.stop();
+    connected = false;
+    if (!abortInput) {
+      emit(GameConnectionMade(1, 1));
     }
   }
 
+  hub.unsubscribe(hubSubscriber);
+  hubSubscriber = -1;
+  closePorts();
+
   quit();
 }
 
+void InputWorker::closePorts() {
+  for (auto *port : ports) {
+    if (port->isConnected()) {
+      port->closeSerial();
+    }
+    delete port;
+  }
+  ports.clear();
+}
+
 InputWorker::~InputWorker() {
   abortInput = true;
   connected = false;
@@ -2,6 +2,7 @@
 #define INPUTWORKER_H
 
 #include <headers/SimConnect.h>
+#include <headers/SimConnectHub.h>
 #include <qmutex.h>
 #include <qsettings.h>
 #include <qstandardpaths.h>
@@ -14,9 +15,12 @@
 #include <QObject>
 #include <cstdio>
 #include <string>
+#include <vector>
 
 #include "InputMapper.h"
 #include "InputSwitchHandler.h"
+#include "inputqueue.h"
+#include "inputreader.h"
 
 /*!
   \class InputWorker
@@ -64,10 +68,17 @@ class InputWorker : public QThread {
   std::string lastStatus;
   InputMapper mapper = InputMapper();
   InputSwitchHandler handler = InputSwitchHandler();
+  // One entry per configured board, opened at the start of inputEvents()
+  std::vector<SerialPort *> ports;
+  InputQueue inputQueue;
+  InputReaders readers{&inputQueue};
+  // Our ID with the SimConnectHub while inputEvents() runs
+  int hubSubscriber = -1;
   QStringList keys = *settingsHandler.retrieveKeys("inputCom");
   std::string prefix;
 
   void inputEvents();
+  void closePorts();
 
   UINT32 HornerScheme(UINT32 Num, UINT32 Divider, UINT32 Factor);
 
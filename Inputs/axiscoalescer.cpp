@@ -0,0 +1,96 @@
+#include "axiscoalescer.h"
+
+#include <headers/constants.h>
+
+#include <algorithm>
+
+const char *AxisCoalescer::name(Axis axis) {
+  static constexpr const char *names[AXIS_COUNT] = {
+      "throttle1",    "throttle2", "throttle3", "throttle4",
+      "prop1",        "prop2",     "prop3",     "prop4",
+      "mixture1",     "mixture2",  "mixture3",  "mixture4",
+      "flaps",        "elevator",  "ailerons",  "elevatorTrim",
+      "rudder",       "leftBrake", "rightBrake"};
+  return names[axis];
+}
+
+void AxisCoalescer::setRate(int flushesPerSecond) {
+  if (flushesPerSecond <= 0) {
+    interval = Clock::duration::zero();
+  } else {
+    interval = Clock::duration(std::chrono::seconds(1)) / flushesPerSecond;
+  }
+}
+
+void AxisCoalescer::queue(Axis axis, SIMCONNECT_CLIENT_EVENT_ID eventID,
+                          int value) {
+  Slot &slot = axisSlots[axis];
+  slot.eventID = eventID;
+  slot.value = value;
+  pending |= 1u << axis;
+}
+
+bool AxisCoalescer::flushDue(Clock::time_point now) const {
+  if (pending == 0) {
+    return false;
+  }
+  if (flushesOnFrame()) {
+    // Don't hold on to values forever when the sim stops sending frames
+    return frameSeen ||
+           now - lastFlush >=
+               std::chrono::milliseconds(constants::axisMaxHoldMs);
+  }
+  return now - lastFlush >= interval;
+}
+
+unsigned long AxisCoalescer::msUntilFlush(Clock::time_point now,
+                                          unsigned long maxWaitMs) const {
+  if (pending == 0) {
+    return maxWaitMs;
+  }
+  if (flushesOnFrame()) {
+    // Frames are only noticed when the worker dispatches, so keep polling
+    return std::min(maxWaitMs, constants::axisFramePollMs);
+  }
+  const auto remaining = std::chrono::duration_cast<std::chrono::milliseconds>(
+      lastFlush + interval - now);
+  if (remaining.count() <= 0) {
+    return 0;
+  }
+  return std::min(maxWaitMs, static_cast<unsigned long>(remaining.count()));
+}
+
+int AxisCoalescer::flush(HANDLE connect, Clock::time_point now) {
+  if (!flushDue(now)) {
+    return 0;
+  }
+  int sent = 0;
+  for (int axis = 0; axis < AXIS_COUNT; axis++) {
+    if (!(pending & (1u << axis))) {
+      continue;
+    }
+    Slot &slot = axisSlots[axis];
+    if (slot.sent && slot.sentValue == slot.value) {
+      continue;
+    }
+    SimConnect_TransmitClientEvent(connect, 0, slot.eventID, slot.value,
+                                   SIMCONNECT_GROUP_PRIORITY_HIGHEST,
+                                   SIMCONNECT_EVENT_FLAG_GROUPID_IS_PRIORITY);
+    slot.sentValue = slot.value;
+    slot.sent = true;
+    sent++;
+  }
+  pending = 0;
+  frameSeen = false;
+  lastFlush = now;
+  return sent;
+}
+
+void AxisCoalescer::reset() {
+  for (auto &slot : axisSlots) {
+    slot.sent = false;
+  }
+  pending = 0;
+  frameSeen = false;
+  lastFlush = Clock::time_point{};
+}
@@ -0,0 +1,84 @@
+#ifndef AXISCOALESCER_H
+#define AXISCOALESCER_H
+
+#include <headers/SimConnect.h>
+#include <windows.h>
+
+#include <array>
+#include <chrono>
+#include <cstdint>
+
+// Keeps the latest value of every analog axis between two flushes so a board
+// streaming samples costs at most one SimConnect event per axis per tick.
+// Buttons and encoders don't go through here, they are sent right away.
+class AxisCoalescer {
+ public:
+  using Clock = std::chrono::steady_clock;
+
+  enum Axis : uint8_t {
+    THROTTLE_1,
+    THROTTLE_2,
+    THROTTLE_3,
+    THROTTLE_4,
+    PROP_1,
+    PROP_2,
+    PROP_3,
+    PROP_4,
+    MIXTURE_1,
+    MIXTURE_2,
+    MIXTURE_3,
+    MIXTURE_4,
+    FLAPS,
+    ELEVATOR,
+    AILERONS,
+    ELEVATOR_TRIM,
+    RUDDER,
+    LEFT_BRAKE,
+    RIGHT_BRAKE,
+    AXIS_COUNT
+  };
+
+  // Name used for the axis in the settings
+  static const char *name(Axis axis);
+
+  // A rate of 0 (the default) flushes on every sim frame, anything else is
+  // the number of flushes per second
+  void setRate(int flushesPerSecond);
+
+  bool flushesOnFrame() const { return interval == Clock::duration::zero(); }
+
+  void queue(Axis axis, SIMCONNECT_CLIENT_EVENT_ID eventID, int value);
+
+  // Called from the SimConnect dispatch when the frame event arrives
+  void frameTick() { frameSeen = true; }
+
+  bool flushDue(Clock::time_point now) const;
+
+  // How long a worker may block before the next flush is due, capped at
+  // maxWaitMs
+  unsigned long msUntilFlush(Clock::time_point now,
+                             unsigned long maxWaitMs) const;
+
+  // Sends every axis that changed since the previous flush, returns the
+  // number of events transmitted
+  int flush(HANDLE connect, Clock::time_point now);
+
+  // Forget what was sent, used after (re)connecting to the sim
+  void reset();
+
+ private:
+  struct Slot {
+    SIMCONNECT_CLIENT_EVENT_ID eventID = 0;
+    int value = 0;
+    int sentValue = 0;
+    bool sent = false;
+  };
+
+  std::array<Slot, AXIS_COUNT> axisSlots{};
+  uint32_t pending = 0;
+  Clock::duration interval = Clock::duration::zero();
+  Clock::time_point lastFlush{};
+  bool frameSeen = false;
+};
+
+#endif  // AXISCOALESCER_H
@@ -0,0 +1,108 @@
+#ifndef AXISCURVE_H
+#define AXISCURVE_H
+
+#include <headers/constants.h>
+#include <settings/coordinates.h>
+
+#include <algorithm>
+#include <array>
+#include <cstdint>
+
+// Calibration curves and throttle ranges evaluated once for every 10-bit
+// input value, so calibrating a sample is a single table load. Kept apart
+// from InputSwitchHandler so the tables can be checked without Qt.
+namespace axiscurve {
+
+using Table = std::array<int16_t, constants::axisResolution>;
+
+inline constexpr float closedAxis = -16383.0;
+inline constexpr float openAxis = 16383.0;
+
+// Table entries are stored as int16, axis values never leave that range
+inline int16_t toAxisEntry(int axis) {
+  return static_cast<int16_t>(std::clamp(axis, -32768, 32767));
+}
+
+inline int mapCoordinates(int value, coordinates toMapMin,
+                          coordinates toMapMax) {
+  return toMapMin.getY() +
+         (toMapMax.getY() - toMapMin.getY()) *
+             ((value - toMapMin.getX()) / (toMapMax.getX() - toMapMin.getX()));
+}
+
+// A curve has seven points, everything between the third and the fifth is
+// the deadzone. Works on any container of coordinates (QList in the
+// handler).
+template <typename Curve>
+int evaluateCurve(int value, const Curve &curve) {
+  // Points beyond the last one in the curve map to its final value
+  int axis = static_cast<int>(curve[6].getY());
+
+  if (static_cast<float>(value) <= curve[1].getX()) {
+    axis = mapCoordinates(value, curve[0], curve[1]);
+  }
+  // minCurve
+  else if (static_cast<float>(value) < curve[2].getX()) {
+    axis = mapCoordinates(value, curve[1], curve[2]);
+  }
+  // deadzone
+  else if (static_cast<float>(value) >= curve[2].getX() &&
+           static_cast<float>(value) <= curve[4].getX()) {
+    axis = 0;
+  } else if (static_cast<float>(value) <= curve[5].getX()) {
+    axis = mapCoordinates(value, curve[4], curve[5]);
+  } else if (static_cast<float>(value) <= curve[6].getX()) {
+    axis = mapCoordinates(value, curve[5], curve[6]);
+  }
+  return axis;
+}
+
+template <typename Curve>
+void bakeCurve(const Curve &curve, Table *table) {
+  for (int value = 0; value < constants::axisResolution; value++) {
+    (*table)[value] = toAxisEntry(evaluateCurve(value, curve));
+  }
+}
+
+inline int mapThrottleValueToAxis(int value, float reverse, float max,
+                                  int idleCutoff, float reverseAxis) {
+  int valueThrottle;
+  bool reversed = max < idleCutoff;
+
+  /*First we check the orientation by determing if max < idleCutoff
+If max < idleCutoff. IF max is smaller we know the potentiometer is mounted
+backwards This affects how our logic needs to operate We want to check if the
+idle cutoff - reverse < 0 This check tells us wether or not the user wants to
+utilize the reverse range or not visa versa for the second check */
+  if ((reversed && idleCutoff - reverse < 0 && value >= idleCutoff) ||
+      (!reversed && idleCutoff - reverse > 0 && value <= idleCutoff)) {
+    valueThrottle =
+        reverseAxis + (closedAxis - reverseAxis) *
+                          ((value - reverse) / (idleCutoff - reverse));
+  } else {
+    valueThrottle =
+        closedAxis +
+        (openAxis - closedAxis) * ((value - idleCutoff) / (max - idleCutoff));
+  }
+  if (valueThrottle > 16383) {
+    return 16383;
+  }
+  return valueThrottle;
+}
+
+inline void bakeThrottle(float reverse, float max, int idleCutoff,
+                         float reverseAxis, Table *table) {
+  for (int value = 0; value < constants::axisResolution; value++) {
+    (*table)[value] = toAxisEntry(
+        mapThrottleValueToAxis(value, reverse, max, idleCutoff, reverseAxis));
+  }
+}
+
+// Values outside the 10-bit range are clamped to it
+inline int lookup(const Table &table, int value) {
+  return table[std::clamp(value, 0, constants::axisResolution - 1)];
+}
+
+}  // namespace axiscurve
+
+#endif  // AXISCURVE_H
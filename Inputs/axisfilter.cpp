@@ -0,0 +1,97 @@
+#include "axisfilter.h"
+
+#include <algorithm>
+#include <cstdlib>
+
+void AxisFilter::configure(const AxisFilterSettings &newSettings) {
+  settings = newSettings;
+  settings.deadband = std::max(settings.deadband, 0);
+  settings.smoothing = std::clamp(settings.smoothing, 0, 99);
+  // Only odd windows have a single middle value
+  settings.medianWindow =
+      std::clamp(settings.medianWindow | 1, 1, maxMedianWindow);
+  settings.slewLimit = std::max(settings.slewLimit, 0);
+
+  median.size = settings.medianWindow;
+  smoothing.keep = settings.smoothing;
+  deadband.width = settings.deadband;
+  slew.maxStep = settings.slewLimit;
+  reset();
+}
+
+int AxisFilter::apply(int sample) {
+  int value = median.apply(sample);
+  value = smoothing.apply(value);
+  value = deadband.apply(value);
+  return slew.apply(value);
+}
+
+void AxisFilter::reset() {
+  median.next = 0;
+  median.filled = 0;
+  smoothing.primed = false;
+  deadband.primed = false;
+  slew.primed = false;
+}
+
+int AxisFilter::MedianStage::apply(int sample) {
+  if (size <= 1) {
+    return sample;
+  }
+  window[next] = sample;
+  next = (next + 1) % size;
+  filled = std::min(filled + 1, size);
+
+  // Insertion sort of at most five values, bounded by the window size so
+  // the compiler can see it stays in the array
+  std::array<int, maxMedianWindow> sorted{};
+  for (int i = 0; i < filled && i < maxMedianWindow; i++) {
+    int j = i;
+    for (; j > 0 && sorted[j - 1] > window[i]; j--) {
+      sorted[j] = sorted[j - 1];
+    }
+    sorted[j] = window[i];
+  }
+  return sorted[filled / 2];
+}
+
+int AxisFilter::SmoothingStage::apply(int sample) {
+  if (keep == 0) {
+    return sample;
+  }
+  if (!primed) {
+    average = sample * 16;
+    primed = true;
+  } else {
+    average = (average * keep + sample * 16 * (100 - keep)) / 100;
+  }
+  return (average + (average >= 0 ? 8 : -8)) / 16;
+}
+
+int AxisFilter::DeadbandStage::apply(int sample) {
+  if (width == 0) {
+    return sample;
+  }
+  if (!primed || std::abs(sample - held) > width) {
+    held = sample;
+    primed = true;
+  }
+  return held;
+}
+
+int AxisFilter::SlewStage::apply(int sample) {
+  if (maxStep == 0) {
+    return sample;
+  }
+  if (!primed) {
+    last = sample;
+    primed = true;
+  } else if (sample > last + maxStep) {
+    last += maxStep;
+  } else if (sample < last - maxStep) {
+    last -= maxStep;
+  } else {
+    last = sample;
+  }
+  return last;
+}
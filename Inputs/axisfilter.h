@@ -0,0 +1,79 @@
+#ifndef AXISFILTER_H
+#define AXISFILTER_H
+
+#include <array>
+
+// How a single analog axis is cleaned up before it is calibrated. A value of
+// 0 (or a median window of 1) switches that stage off.
+struct AxisFilterSettings {
+  // Ignore changes smaller than this, the output only moves once the input
+  // left the band around the last accepted value (hysteresis)
+  int deadband = 0;
+  // Exponential moving average, percentage of the previous value that is
+  // kept (0 - 99)
+  int smoothing = 0;
+  // Median over the last N samples (1, 3 or 5), removes single spikes
+  int medianWindow = 1;
+  // Largest step the output may take per sample
+  int slewLimit = 0;
+};
+
+// Filter pipeline for one axis: median -> moving average -> deadband -> slew
+// limit. All state lives in fixed size members so applying it never
+// allocates.
+class AxisFilter {
+ public:
+  static constexpr int maxMedianWindow = 5;
+
+  void configure(const AxisFilterSettings &settings);
+
+  const AxisFilterSettings &getSettings() const { return settings; }
+
+  int apply(int sample);
+
+  // Drops the history, the next sample passes through unchanged
+  void reset();
+
+ private:
+  struct MedianStage {
+    std::array<int, maxMedianWindow> window{};
+    int size = 1;
+    int next = 0;
+    int filled = 0;
+
+    int apply(int sample);
+  };
+
+  struct SmoothingStage {
+    int keep = 0;
+    // Fixed point with 4 fractional bits so slow movements aren't lost
+    int average = 0;
+    bool primed = false;
+
+    int apply(int sample);
+  };
+
+  struct DeadbandStage {
+    int width = 0;
+    int held = 0;
+    bool primed = false;
+
+    int apply(int sample);
+  };
+
+  struct SlewStage {
+    int maxStep = 0;
+    int last = 0;
+    bool primed = false;
+
+    int apply(int sample);
+  };
+
+  AxisFilterSettings settings;
+  MedianStage median;
+  SmoothingStage smoothing;
+  DeadbandStage deadband;
+  SlewStage slew;
+};
+
+#endif  // AXISFILTER_H
@@ -0,0 +1,141 @@
+#include "encoderaggregator.h"
+
+#include <headers/constants.h>
+
+#include <algorithm>
+#include <cmath>
+#include <cstdlib>
+
+namespace {
+
+void transmit(HANDLE connect, SIMCONNECT_CLIENT_EVENT_ID eventID, int value) {
+  SimConnect_TransmitClientEvent(connect, 0, eventID, static_cast<DWORD>(value),
+                                 SIMCONNECT_GROUP_PRIORITY_HIGHEST,
+                                 SIMCONNECT_EVENT_FLAG_GROUPID_IS_PRIORITY);
+}
+
+int limit(const EncoderTarget &target, int value) {
+  if (target.wraps) {
+    const int span = target.max - target.min;
+    return target.min + ((value - target.min) % span + span) % span;
+  }
+  return std::clamp(value, target.min, target.max);
+}
+
+// Moves the part of value the knob turns by the given amount
+int turn(const EncoderTarget &target, int value, int amount) {
+  int part = value / target.unit;
+  if (target.range > 0) {
+    part %= target.range;
+  }
+  return value + (limit(target, part + amount) - part) * target.unit;
+}
+
+}  // namespace
+
+bool EncoderAggregator::add(SIMCONNECT_CLIENT_EVENT_ID eventID, int direction,
+                            Clock::time_point now) {
+  for (int i = 0; i < encoderTargetCount; i++) {
+    if (encoderTargets[i].incEvent != eventID &&
+        encoderTargets[i].decEvent != eventID) {
+      continue;
+    }
+    if (states[i].detents == 0) {
+      states[i].firstDetent = now;
+    }
+    states[i].detents += direction;
+    return true;
+  }
+  return false;
+}
+
+void EncoderAggregator::defineValues(HANDLE connect) {
+  for (int i = 0; i < encoderTargetCount; i++) {
+    if (encoderValueIndex(i) == i) {
+      SimConnect_AddToDataDefinition(connect, dataDefinitionID,
+                                     encoderTargets[i].simVar,
+                                     encoderTargets[i].units);
+    }
+  }
+}
+
+void EncoderAggregator::requestValues(HANDLE connect) {
+  SimConnect_RequestDataOnSimObject(
+      connect, requestID, dataDefinitionID, SIMCONNECT_OBJECT_ID_USER,
+      SIMCONNECT_PERIOD_VISUAL_FRAME, SIMCONNECT_DATA_REQUEST_FLAG_CHANGED);
+}
+
+void EncoderAggregator::receiveValues(
+    const SIMCONNECT_RECV_SIMOBJECT_DATA *data, Clock::time_point now) {
+  const double *value = reinterpret_cast<const double *>(&data->dwData);
+  for (int i = 0; i < encoderTargetCount; i++) {
+    if (encoderValueIndex(i) != i) {
+      continue;
+    }
+    const double received = *value++;
+    // The sim may still report the value from before our last set, trust
+    // our own value until it had time to catch up
+    if (states[i].known &&
+        now - states[i].lastSent <
+            std::chrono::milliseconds(constants::encoderEchoMs)) {
+      continue;
+    }
+    states[i].value = static_cast<int>(std::lround(received));
+    states[i].known = true;
+  }
+}
+
+unsigned long EncoderAggregator::msUntilFlush(Clock::time_point now,
+                                              unsigned long maxWaitMs) const {
+  unsigned long wait = maxWaitMs;
+  for (const auto &state : states) {
+    if (state.detents == 0) {
+      continue;
+    }
+    const auto remaining =
+        std::chrono::duration_cast<std::chrono::milliseconds>(
+            state.firstDetent +
+            std::chrono::milliseconds(constants::encoderWindowMs) - now);
+    wait = std::min(
+        wait, static_cast<unsigned long>(std::max<long long>(
+                  remaining.count(), 0)));
+  }
+  return wait;
+}
+
+int EncoderAggregator::flush(HANDLE connect, Clock::time_point now) {
+  int sent = 0;
+  for (int i = 0; i < encoderTargetCount; i++) {
+    State &state = states[i];
+    if (state.detents == 0 ||
+        now - state.firstDetent <
+            std::chrono::milliseconds(constants::encoderWindowMs)) {
+      continue;
+    }
+    const EncoderTarget &target = encoderTargets[i];
+    const int step = std::abs(state.detents) >= constants::encoderFastDetents
+                         ? target.fastStep
+                         : target.step;
+    State &shared = states[encoderValueIndex(i)];
+    if (shared.known) {
+      shared.value = turn(target, shared.value, state.detents * step);
+      shared.lastSent = now;
+      transmit(connect, target.setEvent, shared.value);
+      sent++;
+    } else {
+      // Nothing heard from the sim yet, send what the detents add up to as
+      // single steps, fast spins repeat them
+      const auto eventID =
+          state.detents > 0 ? target.incEvent : target.decEvent;
+      const int steps = std::abs(state.detents) * (step / target.step);
+      for (int detent = 0; detent < steps; detent++) {
+        transmit(connect, eventID, 0);
+        sent++;
+      }
+    }
+    state.detents = 0;
+  }
+  return sent;
+}
+
+void EncoderAggregator::reset() { states = {}; }
@@ -0,0 +1,183 @@
+#ifndef ENCODERAGGREGATOR_H
+#define ENCODERAGGREGATOR_H
+
+#include <headers/SimConnect.h>
+#include <headers/SimConnectHub.h>
+#include <windows.h>
+
+#include <array>
+#include <chrono>
+
+#include "inputenum.h"
+
+// A rotary encoder with a _SET counterpart in the sim. Detents arriving
+// within one window are summed and sent as a single absolute value, fast
+// spins move by fastStep per detent instead of step.
+struct EncoderTarget {
+  InputEnum::DATA_DEFINE_ID_INPUT incEvent;
+  InputEnum::DATA_DEFINE_ID_INPUT decEvent;
+  InputEnum::DATA_DEFINE_ID_INPUT setEvent;
+  const char *simVar;
+  const char *units;
+  int step;
+  int fastStep;
+  int min;
+  int max;
+  // Headings and courses wrap around instead of stopping at min / max
+  bool wraps;
+  // The knob turns the part value / unit % range of the value and leaves
+  // the rest alone, a range of 0 means everything above unit. step, min and
+  // max count in that part.
+  int unit = 1;
+  int range = 0;
+};
+
+constexpr int mhz = 1000000;
+
+inline constexpr EncoderTarget encoderTargets[] = {
+    {InputEnum::DEFINITION_HEADING_BUG_INC,
+     InputEnum::DEFINITION_HEADING_BUG_DEC,
+     InputEnum::DEFINITION_HEADING_BUG_SET, "AUTOPILOT HEADING LOCK DIR",
+     "degrees", 1, 5, 0, 360, true},
+    {InputEnum::DEFINITION_AP_ALT_VAR_INC, InputEnum::DEFINITION_AP_ALT_VAR_DEC,
+     InputEnum::DEFINITION_AP_ALT_VAR_SET_ENGLISH,
+     "AUTOPILOT ALTITUDE LOCK VAR", "feet", 100, 1000, 0, 99900, false},
+    {InputEnum::DEFINITION_AP_VS_VAR_INC, InputEnum::DEFINITION_AP_VS_VAR_DEC,
+     InputEnum::DEFINITION_AP_VS_VAR_SET_ENGLISH, "AUTOPILOT VERTICAL HOLD VAR",
+     "feet/minute", 100, 100, -9900, 9900, false},
+    {InputEnum::DEFINITION_AP_SPD_VAR_INC, InputEnum::DEFINITION_AP_SPD_VAR_DEC,
+     InputEnum::DEFINITION_AP_SPD_VAR_SET, "AUTOPILOT AIRSPEED HOLD VAR",
+     "knots", 1, 5, 0, 999, false},
+    {InputEnum::DEFINITION_VOR1_OBI_INC, InputEnum::DEFINITION_VOR1_OBI_DEC,
+     InputEnum::DEFINITION_VOR1_SET, "NAV OBS:1", "degrees", 1, 5, 0, 360,
+     true},
+    {InputEnum::DEFINITION_VOR2_OBI_INC, InputEnum::DEFINITION_VOR2_OBI_DEC,
+     InputEnum::DEFINITION_VOR2_SET, "NAV OBS:2", "degrees", 1, 5, 0, 360,
+     true},
+
+    // The radio knobs tune the standby frequency. The whole knobs wrap the
+    // MHz within the band, the fract knobs the kHz within the MHz and the
+    // carry knobs the frequency within the band.
+    {InputEnum::DEFINITION_COM1_RADIO_WHOLE_INC,
+     InputEnum::DEFINITION_COM1_RADIO_WHOLE_DEC,
+     InputEnum::DEFINITION_COM_STBY_RADIO_SET_HZ, "COM STANDBY FREQUENCY:1",
+     "Hz", 1, 1, 118, 137, true, mhz, 1000},
+    {InputEnum::DEFINITION_COM_RADIO_FRACT_INC,
+     InputEnum::DEFINITION_COM_RADIO_FRACT_DEC,
+     InputEnum::DEFINITION_COM_STBY_RADIO_SET_HZ, "COM STANDBY FREQUENCY:1",
+     "Hz", 25000, 100000, 0, mhz, true, 1, mhz},
+    {InputEnum::DEFINITION_COM_RADIO_FRACT_INC_CARRY,
+     InputEnum::DEFINITION_COM_RADIO_FRACT_DEC_CARRY,
+     InputEnum::DEFINITION_COM_STBY_RADIO_SET_HZ, "COM STANDBY FREQUENCY:1",
+     "Hz", 25000, 100000, 118 * mhz, 137 * mhz, true},
+    {InputEnum::DEFINITION_COM2_RADIO_WHOLE_INC,
+     InputEnum::DEFINITION_COM2_RADIO_WHOLE_DEC,
+     InputEnum::DEFINITION_COM2_STBY_RADIO_SET_HZ, "COM STANDBY FREQUENCY:2",
+     "Hz", 1, 1, 118, 137, true, mhz, 1000},
+    {InputEnum::DEFINITION_COM2_RADIO_FRACT_INC,
+     InputEnum::DEFINITION_COM2_RADIO_FRACT_DEC,
+     InputEnum::DEFINITION_COM2_STBY_RADIO_SET_HZ, "COM STANDBY FREQUENCY:2",
+     "Hz", 25000, 100000, 0, mhz, true, 1, mhz},
+    {InputEnum::DEFINITION_COM2_RADIO_FRACT_INC_CARRY,
+     InputEnum::DEFINITION_COM2_RADIO_FRACT_DEC_CARRY,
+     InputEnum::DEFINITION_COM2_STBY_RADIO_SET_HZ, "COM STANDBY FREQUENCY:2",
+     "Hz", 25000, 100000, 118 * mhz, 137 * mhz, true},
+    {InputEnum::DEFINITION_NAV_1_RADIO_WHOLE_INC,
+     InputEnum::DEFINITION_NAV_1_RADIO_WHOLE_DEC,
+     InputEnum::DEFINITION_NAV1_STBY_SET_HZ, "NAV STANDBY FREQUENCY:1", "Hz",
+     1, 1, 108, 118, true, mhz, 1000},
+    {InputEnum::DEFINITION_NAV_1_RADIO_FRACT_INC,
+     InputEnum::DEFINITION_NAV_1_RADIO_FRACT_DEC,
+     InputEnum::DEFINITION_NAV1_STBY_SET_HZ, "NAV STANDBY FREQUENCY:1", "Hz",
+     50000, 200000, 0, mhz, true, 1, mhz},
+    {InputEnum::DEFINITION_NAV_2_RADIO_WHOLE_INC,
+     InputEnum::DEFINITION_NAV_2_RADIO_WHOLE_DEC,
+     InputEnum::DEFINITION_NAV2_STBY_SET_HZ, "NAV STANDBY FREQUENCY:2", "Hz",
+     1, 1, 108, 118, true, mhz, 1000},
+    {InputEnum::DEFINITION_NAV_2_RADIO_FRACT_INC,
+     InputEnum::DEFINITION_NAV_2_RADIO_FRACT_DEC,
+     InputEnum::DEFINITION_NAV2_STBY_SET_HZ, "NAV STANDBY FREQUENCY:2", "Hz",
+     50000, 200000, 0, mhz, true, 1, mhz},
+
+    // Max bank counts entries of the aircraft's bank list, the sim stops at
+    // the last one the aircraft has
+    {InputEnum::DEFINITION_AP_MAX_BANK_INC,
+     InputEnum::DEFINITION_AP_MAX_BANK_DEC,
+     InputEnum::DEFINITION_AP_MAX_BANK_SET, "AUTOPILOT MAX BANK ID", "number",
+     1, 1, 0, 4, false},
+    {InputEnum::DEFINITION_GYRO_DRIFT_INC, InputEnum::DEFINITION_GYRO_DRIFT_DEC,
+     InputEnum::DEFINITION_GYRO_DRIFT_SET, "GYRO DRIFT ERROR", "degrees", 1, 5,
+     -180, 180, true},
+    {InputEnum::DEFINITION_TRUE_AIRSPEED_CAL_INC,
+     InputEnum::DEFINITION_TRUE_AIRSPEED_CAL_DEC,
+     InputEnum::DEFINITION_TRUE_AIRSPEED_CAL_SET, "AIRSPEED TRUE CALIBRATE",
+     "degrees", 1, 5, -45, 45, false},
+    {InputEnum::DEFINITION_INCREASE_DECISION_HEIGHT,
+     InputEnum::DEFINITION_DECREASE_DECISION_HEIGHT,
+     InputEnum::DEFINITION_DECISION_HEIGHT_SET, "DECISION HEIGHT", "feet", 10,
+     100, 0, 1000, false},
+};
+
+inline constexpr int encoderTargetCount =
+    sizeof(encoderTargets) / sizeof(encoderTargets[0]);
+
+// Knobs that set the same value share the first target's row for it, so
+// turning the fract knob after the whole knob starts from the new MHz
+constexpr int encoderValueIndex(int index) {
+  for (int i = 0; i < index; i++) {
+    if (encoderTargets[i].setEvent == encoderTargets[index].setEvent) {
+      return i;
+    }
+  }
+  return index;
+}
+
+class EncoderAggregator {
+ public:
+  using Clock = std::chrono::steady_clock;
+
+  // Ids used to keep track of the current values in the sim, from the
+  // hub's shared block
+  static constexpr SIMCONNECT_DATA_DEFINITION_ID dataDefinitionID =
+      SimConnectHub::encoderDefinitionID;
+  static constexpr SIMCONNECT_DATA_REQUEST_ID requestID =
+      SimConnectHub::encoderRequestID;
+
+  // Returns false when eventID is not one of the encoder events, the caller
+  // then sends it like any other event
+  bool add(SIMCONNECT_CLIENT_EVENT_ID eventID, int direction,
+           Clock::time_point now);
+
+  // Adds the sim variables of every target to dataDefinitionID, once per
+  // connection and once per value
+  static void defineValues(HANDLE connect);
+  // Subscribes to the values defined by defineValues()
+  void requestValues(HANDLE connect);
+
+  void receiveValues(const SIMCONNECT_RECV_SIMOBJECT_DATA *data,
+                     Clock::time_point now);
+
+  unsigned long msUntilFlush(Clock::time_point now,
+                             unsigned long maxWaitMs) const;
+
+  // Sends the targets whose window has passed, returns the number of events
+  // transmitted
+  int flush(HANDLE connect, Clock::time_point now);
+
+  // Forget the values seen so far, used after (re)connecting to the sim
+  void reset();
+
+ private:
+  struct State {
+    int detents = 0;
+    Clock::time_point firstDetent{};
+    // Only used on the row encoderValueIndex() returns
+    bool known = false;
+    int value = 0;
+    Clock::time_point lastSent{};
+  };
+
+  std::array<State, encoderTargetCount> states{};
+};
+
+#endif  // ENCODERAGGREGATOR_H
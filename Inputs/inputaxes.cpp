@@ -0,0 +1,206 @@
+#include "inputaxes.h"
+
+#include <algorithm>
+#include <iostream>
+
+#include "inputenum.h"
+
+using axiscurve::closedAxis;
+using axiscurve::openAxis;
+
+namespace {
+
+int mapValueToAxis(int value, float min, float max) {
+  return closedAxis + (openAxis - closedAxis) * ((value - min) / (max - min));
+}
+
+}  // namespace
+
+InputAxes::InputAxes(AxisCoalescer *axes) : axes(axes) {
+  for (int i = 0; i < AxisCoalescer::AXIS_COUNT; i++) {
+    const auto axis = static_cast<AxisCoalescer::Axis>(i);
+    filters[i].configure(defaultFilter(axis));
+  }
+}
+
+// At least as strict as the guards the handler had before the filters. The
+// median drops the single spikes and dips the "< 10 after < 20" rule and the
+// rudder and trim jump checks caught, the deadband holds a resting lever
+// still and the slew limit bounds what a longer glitch can do to rudder and
+// trim.
+AxisFilterSettings InputAxes::defaultFilter(AxisCoalescer::Axis axis) {
+  AxisFilterSettings filterSettings;
+  switch (axis) {
+    case AxisCoalescer::THROTTLE_1:
+    case AxisCoalescer::THROTTLE_2:
+    case AxisCoalescer::THROTTLE_3:
+    case AxisCoalescer::THROTTLE_4:
+    case AxisCoalescer::MIXTURE_1:
+    case AxisCoalescer::MIXTURE_2:
+    case AxisCoalescer::MIXTURE_3:
+    case AxisCoalescer::MIXTURE_4:
+    case AxisCoalescer::ELEVATOR:
+    case AxisCoalescer::AILERONS:
+      filterSettings.medianWindow = 3;
+      filterSettings.deadband = 2;
+      break;
+    case AxisCoalescer::RUDDER:
+      // A jump of 10000 on the axis is about 300 counts of the pot
+      filterSettings.medianWindow = 3;
+      filterSettings.slewLimit = 300;
+      break;
+    case AxisCoalescer::ELEVATOR_TRIM:
+      // The trim value goes to the sim unscaled
+      filterSettings.medianWindow = 3;
+      filterSettings.slewLimit = 5000;
+      break;
+    default:
+      break;
+  }
+  return filterSettings;
+}
+
+void InputAxes::configureFilter(AxisCoalescer::Axis axis,
+                                const AxisFilterSettings &settings) {
+  filters[axis].configure(settings);
+}
+
+int InputAxes::calibratedRange(int value, int index) const {
+  return axiscurve::lookup(curveTables[index], value);
+}
+
+void InputAxes::controlYoke(const InputCommand &command) {
+  if (command.fieldCount < 2) {
+    std::cout << "error in yoke" << std::endl;
+    return;
+  }
+  const int elevator =
+      filters[AxisCoalescer::ELEVATOR].apply(command.fields[0]);
+  const int aileron =
+      filters[AxisCoalescer::AILERONS].apply(command.fields[1]);
+  axes->queue(AxisCoalescer::ELEVATOR,
+              InputEnum::DEFINITION_AXIS_ELEVATOR_SET,
+              calibratedRange(elevator, 3));
+  axes->queue(AxisCoalescer::AILERONS,
+              InputEnum::DEFINITION_AXIS_AILERONS_SET,
+              calibratedRange(aileron, 2));
+}
+
+void InputAxes::setFlaps(const InputCommand &command) {
+  if (command.fieldCount > 0) {
+    state.flaps = filters[AxisCoalescer::FLAPS].apply(command.fields[0]);
+  }
+  axes->queue(AxisCoalescer::FLAPS, InputEnum::DEFINITION_AXIS_FLAPS_SET,
+              mapValueToAxis(state.flaps, flapsRange.getMinRange(),
+                             flapsRange.getMaxRange()));
+}
+
+void InputAxes::setThrottles(const InputCommand &command) {
+  if (command.fieldCount < constants::supportedEngines) {
+    std::cout << "error in throttle" << std::endl;
+    return;
+  }
+  for (int i = 0; i < constants::supportedEngines; i++) {
+    const auto axis = static_cast<AxisCoalescer::Axis>(
+        AxisCoalescer::THROTTLE_1 + i);
+    const int value = filters[axis].apply(command.fields[i]);
+    state.mappedEngines[i] = axiscurve::lookup(throttleTables[i], value);
+  }
+  axes->queue(AxisCoalescer::THROTTLE_1, InputEnum::DATA_EX_THROTTLE_1_AXIS,
+              state.mappedEngines[0]);
+  axes->queue(AxisCoalescer::THROTTLE_2, InputEnum::DATA_EX_THROTTLE_2_AXIS,
+              state.mappedEngines[1]);
+  axes->queue(AxisCoalescer::THROTTLE_3, InputEnum::DATA_EX_THROTTLE_3_AXIS,
+              state.mappedEngines[2]);
+  axes->queue(AxisCoalescer::THROTTLE_4, InputEnum::DATA_EX_THROTTLE_4_AXIS,
+              state.mappedEngines[3]);
+}
+
+void InputAxes::setMixture(const InputCommand &command) {
+  if (command.fieldCount == 0) {
+    std::cout << "error in mixture" << std::endl;
+    return;
+  }
+  const int levers =
+      std::min(command.fieldCount, constants::supportedMixtureLevers);
+  for (int i = 0; i < levers; i++) {
+    int incVal = command.fields[i];
+    if (incVal == 98) {
+      incVal = 100;
+    }
+    const auto axis =
+        static_cast<AxisCoalescer::Axis>(AxisCoalescer::MIXTURE_1 + i);
+    state.mappedMixture[i] = mapValueToAxis(filters[axis].apply(incVal),
+                                            mixtureRanges[i].getMinRange(),
+                                            mixtureRanges[i].getMaxRange());
+  }
+  axes->queue(AxisCoalescer::MIXTURE_1,
+              InputEnum::DEFINITION_MIXTURE_LEVER_AXIS_1,
+              state.mappedMixture[0]);
+  axes->queue(AxisCoalescer::MIXTURE_2,
+              InputEnum::DEFINITION_MIXTURE_LEVER_AXIS_2,
+              state.mappedMixture[1]);
+  axes->queue(AxisCoalescer::MIXTURE_3,
+              InputEnum::DEFINITION_MIXTURE_LEVER_AXIS_3,
+              state.mappedMixture[0]);
+  axes->queue(AxisCoalescer::MIXTURE_4,
+              InputEnum::DEFINITION_MIXTURE_LEVER_AXIS_4,
+              state.mappedMixture[1]);
+}
+
+void InputAxes::setProps(const InputCommand &command) {
+  if (command.fieldCount < constants::supportedPropellerLevers) {
+    std::cout << "error in propeller" << std::endl;
+    return;
+  }
+  for (int i = 0; i < constants::supportedPropellerLevers; i++) {
+    const auto axis =
+        static_cast<AxisCoalescer::Axis>(AxisCoalescer::PROP_1 + i);
+    state.mappedProps[i] =
+        mapValueToAxis(filters[axis].apply(command.fields[i]),
+                       propellerRanges[0].getMinRange(),
+                       propellerRanges[0].getMaxRange());
+  }
+
+  axes->queue(AxisCoalescer::PROP_1, InputEnum::DEFINITION_PROP_LEVER_AXIS_1,
+              state.mappedProps[0]);
+  axes->queue(AxisCoalescer::PROP_2, InputEnum::DEFINITION_PROP_LEVER_AXIS_2,
+              state.mappedProps[1]);
+  axes->queue(AxisCoalescer::PROP_3, InputEnum::DEFINITION_PROP_LEVER_AXIS_3,
+              state.mappedProps[0]);
+  axes->queue(AxisCoalescer::PROP_4, InputEnum::DEFINITION_PROP_LEVER_AXIS_4,
+              state.mappedProps[1]);
+}
+
+void InputAxes::setElevatorTrim(const InputCommand &command) {
+  if (command.fieldCount > 0) {
+    state.trim =
+        filters[AxisCoalescer::ELEVATOR_TRIM].apply(command.fields[0]);
+  }
+  axes->queue(AxisCoalescer::ELEVATOR_TRIM,
+              InputEnum::DEFINITION_ELEVATOR_TRIM_SET, state.trim);
+}
+
+void InputAxes::setRudder(const InputCommand &command) {
+  if (command.fieldCount > 0) {
+    state.rudder = calibratedRange(
+        filters[AxisCoalescer::RUDDER].apply(command.fields[0]), 0);
+  }
+  axes->queue(AxisCoalescer::RUDDER, InputEnum::DEFINITION_AXIS_RUDDER_SET,
+              state.rudder);
+}
+
+void InputAxes::setBrakes(const InputCommand &command) {
+  if (command.fieldCount > 0) {
+    state.leftBrake = calibratedRange(
+        filters[AxisCoalescer::LEFT_BRAKE].apply(command.fields[0]), 1);
+  }
+  if (command.fieldCount > 1) {
+    state.rightBrake = calibratedRange(
+        filters[AxisCoalescer::RIGHT_BRAKE].apply(command.fields[1]), 1);
+  }
+  axes->queue(AxisCoalescer::RIGHT_BRAKE,
+              InputEnum::DEFINITION_AXIS_RIGHT_BRAKE_SET, state.rightBrake);
+  axes->queue(AxisCoalescer::LEFT_BRAKE,
+              InputEnum::DEFINITION_AXIS_LEFT_BRAKE_SET, state.leftBrake);
+}
@@ -0,0 +1,70 @@
+#ifndef INPUTAXES_H
+#define INPUTAXES_H
+
+#include <Inputs/axiscoalescer.h>
+#include <Inputs/axiscurve.h>
+#include <Inputs/axisfilter.h>
+#include <headers/constants.h>
+#include <headers/range.h>
+
+#include <array>
+
+#include "inputcommand.h"
+
+// Axis and lever history of a single handler. Every InputSwitchHandler owns
+// its own block so the input and dual workers (or one handler per board) can
+// run on separate threads without sharing state. The block is cache line
+// aligned and holds the most frequently updated axes first.
+struct alignas(64) InputAxisState {
+  int rudder = 0;
+  int leftBrake = 0;
+  int rightBrake = 0;
+  int mappedEngines[constants::supportedEngines] = {};
+  int mappedProps[constants::supportedPropellerLevers] = {};
+  int mappedMixture[constants::supportedMixtureLevers] = {};
+  int flaps = 0;
+  int trim = 0;
+};
+
+// The analog axes of one handler. Raw samples go through the axis filters,
+// the calibration tables and the lever ranges into the handler's
+// InputAxisState, and the results are queued on its coalescer. Needs no Qt,
+// so the tests can run one per thread.
+class InputAxes {
+ public:
+  explicit InputAxes(AxisCoalescer *axes);
+
+  // Filters used when the settings don't configure an axis
+  static AxisFilterSettings defaultFilter(AxisCoalescer::Axis axis);
+
+  void configureFilter(AxisCoalescer::Axis axis,
+                       const AxisFilterSettings &settings);
+
+  void controlYoke(const InputCommand &command);
+  void setFlaps(const InputCommand &command);
+  void setThrottles(const InputCommand &command);
+  void setMixture(const InputCommand &command);
+  void setProps(const InputCommand &command);
+  void setElevatorTrim(const InputCommand &command);
+  void setRudder(const InputCommand &command);
+  void setBrakes(const InputCommand &command);
+
+  const InputAxisState &getState() const { return state; }
+
+  // Rudder, toe brakes, aileron and elevator, in the order of the handler's
+  // curves
+  std::array<axiscurve::Table, 4> curveTables{};
+  std::array<axiscurve::Table, constants::supportedEngines> throttleTables{};
+  std::array<Range, constants::supportedMixtureLevers> mixtureRanges;
+  std::array<Range, constants::supportedPropellerLevers> propellerRanges;
+  Range flapsRange;
+
+ private:
+  int calibratedRange(int value, int index) const;
+
+  AxisCoalescer *axes;
+  InputAxisState state;
+  std::array<AxisFilter, AxisCoalescer::AXIS_COUNT> filters;
+};
+
+#endif  // INPUTAXES_H
@@ -0,0 +1,93 @@
+#include "inputcommand.h"
+
+#include <algorithm>
+#include <charconv>
+
+namespace {
+
+bool isBlank(char c) { return c == ' ' || c == '\t'; }
+
+// Parses an integer token, a fractional part is accepted and truncated since
+// some boards send their analog values as floats
+const char *parseField(const char *first, const char *last, int *value) {
+  auto [ptr, ec] = std::from_chars(first, last, *value);
+  if (ec != std::errc() || ptr == first) {
+    return nullptr;
+  }
+  if (ptr != last && *ptr == '.') {
+    ptr++;
+    while (ptr != last && *ptr >= '0' && *ptr <= '9') {
+      ptr++;
+    }
+  }
+  if (ptr != last && !isBlank(*ptr)) {
+    return nullptr;
+  }
+  return ptr;
+}
+
+}  // namespace
+
+InputCommand parseInputCommand(std::string_view line) {
+  InputCommand command;
+  if (line.size() < 3) {
+    return command;
+  }
+
+  const char *cursor = line.data();
+  const char *last = line.data() + line.size();
+  const char *prefixEnd =
+      line.data() + std::min(line.size(), InputCommand::prefixWidth);
+
+  while (cursor != prefixEnd && isBlank(*cursor)) {
+    cursor++;
+  }
+  auto [ptr, ec] = std::from_chars(cursor, prefixEnd, command.prefix);
+  if (ec != std::errc() || ptr == cursor || command.prefix < 0) {
+    command.status = InputCommand::BAD_PREFIX;
+    return command;
+  }
+  cursor = ptr;
+  if (cursor != prefixEnd && !isBlank(*cursor)) {
+    command.status = InputCommand::BAD_PREFIX;
+    return command;
+  }
+
+  while (true) {
+    while (cursor != last && isBlank(*cursor)) {
+      cursor++;
+    }
+    if (cursor == last) {
+      break;
+    }
+    if (command.fieldCount == InputCommand::maxFields) {
+      command.status = InputCommand::TOO_MANY_FIELDS;
+      return command;
+    }
+    cursor = parseField(cursor, last, &command.fields[command.fieldCount]);
+    if (cursor == nullptr) {
+      command.status = InputCommand::BAD_FIELD;
+      return command;
+    }
+    command.fieldCount++;
+  }
+
+  command.status = InputCommand::OK;
+  return command;
+}
+
+const char *inputCommandStatusText(InputCommand::Status status) {
+  switch (status) {
+    case InputCommand::OK:
+      return "ok";
+    case InputCommand::EMPTY:
+      return "empty message";
+    case InputCommand::BAD_PREFIX:
+      return "invalid prefix";
+    case InputCommand::BAD_FIELD:
+      return "invalid value";
+    case InputCommand::TOO_MANY_FIELDS:
+      return "too many values";
+  }
+  return "unknown";
+}
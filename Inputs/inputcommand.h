@@ -0,0 +1,30 @@
+#ifndef INPUTCOMMAND_H
+#define INPUTCOMMAND_H
+
+#include <array>
+#include <string_view>
+
+// A board message split into its prefix and the space separated values that
+// follow it, e.g. "199 512 512 600 600" for the four throttle levers.
+struct InputCommand {
+  static constexpr int maxFields = 8;
+  // Everything within the first prefixWidth characters belongs to the prefix
+  static constexpr size_t prefixWidth = 4;
+
+  enum Status { OK, EMPTY, BAD_PREFIX, BAD_FIELD, TOO_MANY_FIELDS };
+
+  Status status = EMPTY;
+  int prefix = 0;
+  int fieldCount = 0;
+  std::array<int, maxFields> fields{};
+
+  bool isValid() const { return status == OK; }
+};
+
+// Parses a single line without allocating or throwing, problems are reported
+// through InputCommand::status
+InputCommand parseInputCommand(std::string_view line);
+
+const char *inputCommandStatusText(InputCommand::Status status);
+
+#endif  // INPUTCOMMAND_H
@@ -0,0 +1,594 @@
+#ifndef INPUTDISPATCHTABLE_H
+#define INPUTDISPATCHTABLE_H
+
+#include <array>
+#include <cstdint>
+
+#include "inputenum.h"
+
+// Every message a board sends starts with a prefix between 0 and 9999. The
+// prefix is used as an index into a table that is generated at compile time
+// from the rows below, so looking up what to do with a message costs a single
+// load. Adding a new event is done by adding a row, not a new case.
+namespace inputdispatch {
+
+enum HandlerKind : uint8_t {
+  // Prefixes without a row are forwarded to the WASM module
+  WASM = 0,
+  BASIC,
+  VALUE,
+  ON,
+  OFF,
+  PROPS,
+  THROTTLE,
+  MIXTURE,
+  YOKE,
+  FLAPS,
+  ELEVATOR_TRIM,
+  RUDDER,
+  BRAKES,
+  COM1_SET,
+  COM2_SET,
+  XPNDR_SET,
+  FUEL_SELECTOR_SMOKE,
+  // Rotary encoder detent, value holds the direction (1 or -1)
+  ENCODER,
+};
+
+struct Entry {
+  HandlerKind kind = WASM;
+  int8_t value = 0;
+  uint16_t event = 0;
+};
+
+struct Row {
+  int prefix;
+  HandlerKind kind;
+  int event = 0;
+  int value = 0;
+};
+
+inline constexpr int maxPrefix{9999};
+
+inline constexpr Row rows[] = {
+    {198, PROPS},
+    {199, THROTTLE},
+    {115, MIXTURE},
+    {103, YOKE},
+    {100, COM1_SET, InputEnum::DEFINITION_COM_1_SET},
+    {102, COM2_SET, InputEnum::DEFINITION_COM_2_SET},
+    {111, ENCODER, InputEnum::DEFINITION_COM1_RADIO_WHOLE_DEC, -1},
+    {112, ENCODER, InputEnum::DEFINITION_COM1_RADIO_WHOLE_INC, 1},
+    {113, ENCODER, InputEnum::DEFINITION_COM2_RADIO_WHOLE_DEC, -1},
+    {114, ENCODER, InputEnum::DEFINITION_COM2_RADIO_WHOLE_INC, 1},
+    // Swap com1
+    {116, BASIC, InputEnum::DEFINITION_COM_STANDBY_SWAP},
+    // Swap com2
+    {117, BASIC, InputEnum::DEFINITION_COM_2_STANDBY_SWAP},
+    // Swap nav1
+    {118, BASIC, InputEnum::DEFINITION_NAV_1_STANDBY_SWAP},
+    // Swap nav1
+    {119, BASIC, InputEnum::DEFINITION_NAV_2_STANDBY_SWAP},
+    {120, ENCODER, InputEnum::DEFINITION_COM2_RADIO_FRACT_DEC, -1},
+    {121, ENCODER, InputEnum::DEFINITION_COM2_RADIO_FRACT_INC, 1},
+    {122, ENCODER, InputEnum::DEFINITION_COM2_RADIO_FRACT_DEC_CARRY, -1},
+    {123, ENCODER, InputEnum::DEFINITION_COM2_RADIO_FRACT_INC_CARRY, 1},
+    {124, ENCODER, InputEnum::DEFINITION_COM_RADIO_FRACT_DEC, -1},
+    {125, ENCODER, InputEnum::DEFINITION_COM_RADIO_FRACT_INC, 1},
+    {126, ENCODER, InputEnum::DEFINITION_COM_RADIO_FRACT_DEC_CARRY, -1},
+    {127, ENCODER, InputEnum::DEFINITION_COM_RADIO_FRACT_INC_CARRY, 1},
+    // NAV
+    {128, ENCODER, InputEnum::DEFINITION_NAV_1_RADIO_FRACT_INC, 1},
+    {129, ENCODER, InputEnum::DEFINITION_NAV_1_RADIO_FRACT_DEC, -1},
+    {130, ENCODER, InputEnum::DEFINITION_NAV_2_RADIO_FRACT_INC, 1},
+    {131, ENCODER, InputEnum::DEFINITION_NAV_2_RADIO_FRACT_DEC, -1},
+    {132, ENCODER, InputEnum::DEFINITION_NAV_1_RADIO_WHOLE_INC, 1},
+    {133, ENCODER, InputEnum::DEFINITION_NAV_1_RADIO_WHOLE_DEC, -1},
+    {134, ENCODER, InputEnum::DEFINITION_NAV_2_RADIO_WHOLE_INC, 1},
+    {135, ENCODER, InputEnum::DEFINITION_NAV_2_RADIO_WHOLE_DEC, -1},
+    // DME
+    {136, BASIC, InputEnum::DEFINITION_RADIO_SELECTED_DME1_IDENT_ENABLE},
+    {137, BASIC, InputEnum::DEFINITION_RADIO_SELECTED_DME1_IDENT_DISABLE},
+    {138, BASIC, InputEnum::DEFINITION_RADIO_SELECTED_DME1_IDENT_SET},
+    {139, BASIC, InputEnum::DEFINITION_RADIO_SELECTED_DM1E_IDENT_TOGGLE},
+    {140, BASIC, InputEnum::DEFINITION_RADIO_SELECTED_DME2_IDENT_ENABLE},
+    {141, BASIC, InputEnum::DEFINITION_RADIO_SELECTED_DME2_IDENT_DISABLE},
+    {142, BASIC, InputEnum::DEFINITION_RADIO_SELECTED_DME2_IDENT_SET},
+    {143, BASIC, InputEnum::DEFINITION_RADIO_SELECTED_DME2_IDENT_TOGGLE},
+    {144, BASIC, InputEnum::DEFINITION_TOGGLE_DME},
+    // VOR1
+    {145, BASIC, InputEnum::DEFINITION_RADIO_SELECTED_VOR1_IDENT_ENABLE},
+    {146, BASIC, InputEnum::DEFINITION_RADIO_SELECTED_VOR1_IDENT_DISABLE},
+    {147, BASIC, InputEnum::DEFINITION_RADIO_SELECTED_VOR1_IDENT_SET},
+    {148, BASIC, InputEnum::DEFINITION_RADIO_SELECTED_VORE_IDENT_TOGGLE},
+    {149, BASIC, InputEnum::DEFINITION_RADIO_SELECTED_VOR2_IDENT_ENABLE},
+    {150, BASIC, InputEnum::DEFINITION_RADIO_SELECTED_VOR2_IDENT_DISABLE},
+    // TO DO SET FUNCTION
+    {151, BASIC, InputEnum::DEFINITION_RADIO_SELECTED_VOR2_IDENT_SET},
+    {152, BASIC, InputEnum::DEFINITION_RADIO_SELECTED_VOR2_IDENT_TOGGLE},
+    {153, BASIC, InputEnum::DEFINITION_TOGGLE_VOR},
+    {154, ENCODER, InputEnum::DEFINITION_VOR1_OBI_DEC, -1},
+    {155, ENCODER, InputEnum::DEFINITION_VOR1_OBI_INC, 1},
+    {156, ENCODER, InputEnum::DEFINITION_VOR2_OBI_DEC, -1},
+    {157, ENCODER, InputEnum::DEFINITION_VOR2_OBI_INC, 1},
+    // ADF
+    {158, BASIC, InputEnum::DEFINITION_RADIO_SELECTED_ADF_IDENT_ENABLE},
+    {159, BASIC, InputEnum::DEFINITION_RADIO_SELECTED_ADF_IDENT_DISABLE},
+    // TO DO SET FUNCTION
+    {160, BASIC, InputEnum::DEFINITION_RADIO_SELECTED_ADF_IDENT_SET},
+    {161, BASIC, InputEnum::DEFINITION_RADIO_SELECTED_ADF_IDENT_TOGGLE},
+    {162, BASIC, InputEnum::DEFINITION_ADF_CARD_INC},
+    {163, BASIC, InputEnum::DEFINITION_ADF_CARD_DEC},
+    // TO DO SET FUNCTION
+    {164, BASIC, InputEnum::DEFINITION_ADF_CARD_SET},
+    {165, BASIC, InputEnum::DEFINITION_ADF_100_INC},
+    {166, BASIC, InputEnum::DEFINITION_ADF_10_INC},
+    {167, BASIC, InputEnum::DEFINITION_ADF_1_INC},
+    {168, BASIC, InputEnum::DEFINITION_ADF_100_DEC},
+    {169, BASIC, InputEnum::DEFINITION_ADF_10_DEC},
+    {170, BASIC, InputEnum::DEFINITION_ADF_1_DEC},
+    // XPNDR
+    {171, BASIC, InputEnum::DEFINITION_XPNDR_1000_INC},
+    {172, BASIC, InputEnum::DEFINITION_XPNDR_100_INC},
+    {173, BASIC, InputEnum::DEFINITION_XPNDR_10_INC},
+    {174, BASIC, InputEnum::DEFINITION_XPNDR_1_INC},
+    {175, BASIC, InputEnum::DEFINITION_XPNDR_1000_DEC},
+    {176, BASIC, InputEnum::DEFINITION_XPNDR_100_DEC},
+    {177, BASIC, InputEnum::DEFINITION_XPNDR_10_DEC},
+    {178, BASIC, InputEnum::DEFINITION_XPNDR_1_DEC},
+    {202, XPNDR_SET, InputEnum::DEFINITION_XPNDR_SET},
+    // TO DO SET FUNCTION
+    {179, BASIC, InputEnum::DEFINITION_ADF_COMPLETE_SET},
+    {180, BASIC, InputEnum::DEFINITION_ADF1_WHOLE_INC},
+    {181, BASIC, InputEnum::DEFINITION_ADF1_WHOLE_DEC},
+    {182, BASIC, InputEnum::DEFINITION_ADF2_100_INC},
+    {183, BASIC, InputEnum::DEFINITION_ADF2_10_INC},
+    {184, BASIC, InputEnum::DEFINITION_ADF2_1_INC},
+    {185, BASIC, InputEnum::DEFINITION_ADF2_RADIO_TENTHS_INC},
+    {186, BASIC, InputEnum::DEFINITION_ADF2_100_DEC},
+    {187, BASIC, InputEnum::DEFINITION_ADF2_10_DEC},
+    {188, BASIC, InputEnum::DEFINITION_ADF2_1_DEC},
+    {189, BASIC, InputEnum::DEFINITION_ADF2_RADIO_TENTHS_DEC},
+    {190, BASIC, InputEnum::DEFINITION_ADF2_WHOLE_INC},
+    {191, BASIC, InputEnum::DEFINITION_ADF2_WHOLE_DEC},
+    {192, BASIC, InputEnum::DEFINITION_ADF2_FRACT_DEC_CARRY},
+    {193, BASIC, InputEnum::DEFINITION_ADF2_FRACT_INC_CARRY},
+    // TO DO SET FUNCTION
+    {194, BASIC, InputEnum::DEFINITION_ADF2_COMPLETE_SET},
+    {195, BASIC, InputEnum::DEFINITION_RADIO_ADF2_IDENT_DISABLE},
+    {196, BASIC, InputEnum::DEFINITION_RADIO_ADF2_IDENT_ENABLE},
+    {197, BASIC, InputEnum::DEFINITION_RADIO_ADF2_IDENT_TOGGLE},
+    // TO DO SET FUNCTION
+    {200, BASIC, InputEnum::DEFINITION_RADIO_ADF2_IDENT_SET},
+    {201, BASIC, InputEnum::DEFINITION_ENG_AUTO_IGN_1},
+    {250, BASIC, InputEnum::DEFINITION_G1000_PFD_ZOOMOUT_BUTTON},
+    {251, BASIC, InputEnum::DEFINITION_G1000_PFD_ZOOMIN_BUTTON},
+    // AP
+    {301, BASIC, InputEnum::DEFINITION_AP_MASTER},
+    {302, BASIC, InputEnum::DEFINITION_AP_PANEL_HEADING_HOLD},
+    {303, BASIC, InputEnum::DEFINITION_AP_PANEL_ALTITUDE_HOLD},
+    {304, BASIC, InputEnum::DEFINITION_AP_ATT_HOLD_ON},
+    {305, BASIC, InputEnum::DEFINITION_AP_LOC_HOLD_ON},
+    {306, BASIC, InputEnum::DEFINITION_AP_APR_HOLD_ON},
+    {307, BASIC, InputEnum::DEFINITION_AP_HDG_HOLD_ON},
+    {308, BASIC, InputEnum::DEFINITION_AP_ALT_HOLD_ON},
+    {309, BASIC, InputEnum::DEFINITION_AP_WING_LEVELER_ON},
+    {310, BASIC, InputEnum::DEFINITION_AP_BC_HOLD_ON},
+    {311, BASIC, InputEnum::DEFINITION_AP_NAV1_HOLD_ON},
+    {312, BASIC, InputEnum::DEFINITION_AP_ATT_HOLD_OFF},
+    {313, BASIC, InputEnum::DEFINITION_AP_LOC_HOLD_OFF},
+    {314, BASIC, InputEnum::DEFINITION_AP_APR_HOLD_OFF},
+    {315, BASIC, InputEnum::DEFINITION_AP_HDG_HOLD_OFF},
+    {316, BASIC, InputEnum::DEFINITION_AP_ALT_HOLD_OFF},
+    {317, BASIC, InputEnum::DEFINITION_AP_WING_LEVELER_OFF},
+    {318, BASIC, InputEnum::DEFINITION_AP_BC_HOLD_OFF},
+    {319, BASIC, InputEnum::DEFINITION_AP_NAV1_HOLD_OFF},
+    {320, BASIC, InputEnum::DEFINITION_AP_AIRSPEED_HOLD},
+    {321, BASIC, InputEnum::DEFINITION_AP_PANEL_SPEED_HOLD},
+    {322, ENCODER, InputEnum::DEFINITION_AP_ALT_VAR_INC, 1},
+    {323, ENCODER, InputEnum::DEFINITION_AP_ALT_VAR_DEC, -1},
+    {324, ENCODER, InputEnum::DEFINITION_AP_VS_VAR_INC, 1},
+    {325, ENCODER, InputEnum::DEFINITION_AP_VS_VAR_DEC, -1},
+    {326, ENCODER, InputEnum::DEFINITION_AP_SPD_VAR_INC, 1},
+    {327, ENCODER, InputEnum::DEFINITION_AP_SPD_VAR_DEC, -1},
+    {328, BASIC, InputEnum::DEFINITION_AP_PANEL_MACH_HOLD},
+    {329, BASIC, InputEnum::DEFINITION_AP_MACH_VAR_INC},
+    {330, BASIC, InputEnum::DEFINITION_AP_MACH_VAR_DEC},
+    {331, BASIC, InputEnum::DEFINITION_AP_MACH_HOLD},
+    // TO DO SET FUNCTION
+    {332, BASIC, InputEnum::DEFINITION_AP_ALT_VAR_SET_METRIC},
+    // TO DO SET FUNCTION
+    {333, BASIC, InputEnum::DEFINITION_AP_VS_VAR_SET_ENGLISH},
+    // TO DO SET FUNCTION
+    {334, BASIC, InputEnum::DEFINITION_AP_SPD_VAR_SET},
+    // TO DO SET FUNCTION
+    {335, BASIC, InputEnum::DEFINITION_AP_MACH_VAR_SET},
+    {336, BASIC, InputEnum::DEFINITION_AP_AIRSPEED_ON},
+    {337, BASIC, InputEnum::DEFINITION_AP_AIRSPEED_OFF},
+    // TO DO SET FUNCTION
+    {338, BASIC, InputEnum::DEFINITION_AP_AIRSPEED_SET},
+    {339, BASIC, InputEnum::DEFINITION_AP_MACH_ON},
+    {340, BASIC, InputEnum::DEFINITION_AP_MACH_OFF},
+    // TO DO SET FUNCTION
+    {341, BASIC, InputEnum::DEFINITION_AP_MACH_SET},
+    {342, BASIC, InputEnum::DEFINITION_AP_PANEL_ALTITUDE_ON},
+    {343, BASIC, InputEnum::DEFINITION_AP_PANEL_ALTITUDE_OFF},
+    // TO DO SET FUNCTION
+    {345, BASIC, InputEnum::DEFINITION_AP_PANEL_ALTITUDE_SET},
+    {346, BASIC, InputEnum::DEFINITION_AP_PANEL_HEADING_ON},
+    {347, BASIC, InputEnum::DEFINITION_AP_PANEL_HEADING_OFF},
+    // TO DO SET FUNCTION
+    {348, BASIC, InputEnum::DEFINITION_AP_PANEL_HEADING_SET},
+    {349, BASIC, InputEnum::DEFINITION_AP_PANEL_MACH_ON},
+    {350, BASIC, InputEnum::DEFINITION_AP_PANEL_MACH_OFF},
+    // TO DO SET FUNCTION
+    {351, BASIC, InputEnum::DEFINITION_AP_PANEL_MACH_SET},
+    {352, BASIC, InputEnum::DEFINITION_AP_PANEL_SPEED_ON},
+    {353, BASIC, InputEnum::DEFINITION_AP_PANEL_SPEED_OFF},
+    // TO DO SET FUNCTION
+    {354, BASIC, InputEnum::DEFINITION_AP_PANEL_SPEED_SET},
+    // TO DO SET FUNCTION
+    {355, BASIC, InputEnum::DEFINITION_AP_ALT_VAR_SET_ENGLISH},
+    // TO DO SET FUNCTION
+    {356, BASIC, InputEnum::DEFINITION_AP_VS_VAR_SET_METRIC},
+    {357, BASIC, InputEnum::DEFINITION_AP_PANEL_SPEED_HOLD_TOGGLE},
+    {358, BASIC, InputEnum::DEFINITION_AP_PANEL_MACH_HOLD_TOGGLE},
+    // TO DO SET FUNCTION
+    {359, BASIC, InputEnum::DEFINITION_AP_NAV_SELECT_SET},
+    {360, BASIC, InputEnum::DEFINITION_AP_PITCH_REF_INC_UP},
+    {361, BASIC, InputEnum::DEFINITION_AP_PITCH_REF_INC_DN},
+    {362, BASIC, InputEnum::DEFINITION_AP_PITCH_REF_SELECT},
+    {363, BASIC, InputEnum::DEFINITION_AP_ATT_HOLD},
+    {364, BASIC, InputEnum::DEFINITION_AP_LOC_HOLD},
+    {365, BASIC, InputEnum::DEFINITION_AP_APR_HOLD},
+    {366, BASIC, InputEnum::DEFINITION_AP_HDG_HOLD},
+    {367, BASIC, InputEnum::DEFINITION_AP_ALT_HOLD},
+    {368, BASIC, InputEnum::DEFINITION_AP_WING_LEVELER},
+    {369, BASIC, InputEnum::DEFINITION_AP_BC_HOLD},
+    {370, BASIC, InputEnum::DEFINITION_AP_NAV1_HOLD},
+    {371, ENCODER, InputEnum::DEFINITION_HEADING_BUG_INC, 1},
+    {372, ENCODER, InputEnum::DEFINITION_HEADING_BUG_DEC, -1},
+    {373, BASIC, InputEnum::DEFINITION_TOGGLE_FLIGHT_DIRECTOR},
+    {374, BASIC, InputEnum::DEFINITION_AP_VS_HOLD},
+    {375, BASIC, InputEnum::DEFINITION_KOHLSMAN_INC},
+    {376, BASIC, InputEnum::DEFINITION_KOHLSMAN_DEC},
+    {378, BASIC, InputEnum::DEFINITION_AUTO_THROTTLE_ARM},
+    {379, BASIC, InputEnum::DEFINITION_AUTO_THROTTLE_TO_GA},
+    // Avionics
+    // TO DO CHECK IF WORKS
+    {401, OFF, InputEnum::DEFINITION_TOGGLE_AVIONICS1_MASTER_OFF},
+    {402, ON, InputEnum::DEFINITION_TOGGLE_AVIONICS1_MASTER_ON},
+    {403, OFF, InputEnum::DEFINITION_TOGGLE_AVIONICS2_MASTER_OFF},
+    {404, ON, InputEnum::DEFINITION_TOGGLE_AVIONICS2_MASTER_ON},
+    // TO DO FUNCTION ON OFF Battery
+    {405, VALUE, InputEnum::DEFINITION_TOGGLE_MASTER_BATTERY, 1},
+    {406, VALUE, InputEnum::DEFINITION_TOGGLE_MASTER_BATTERY, 2},
+    {407, BASIC, InputEnum::DEFINITION_TOGGLE_MASTER_ALTERNATOR},
+    {408, BASIC, InputEnum::DEFINITION_TOGGLE_EXTERNAL_POWER},
+    {420, BASIC, InputEnum::DEFINITION_PARKING_BRAKE},
+    {421, FLAPS},
+    {501, BASIC, InputEnum::DEFINITION_FLAPS_UP},
+    {502, BASIC, InputEnum::DEFINITION_FLAPS_1},
+    {503, BASIC, InputEnum::DEFINITION_FLAPS_2},
+    {504, BASIC, InputEnum::DEFINITION_FLAPS_3},
+    {505, BASIC, InputEnum::DEFINITION_FLAPS_DOWN},
+    {506, BASIC, InputEnum::DEFINITION_FLAPS_INCR},
+    {507, BASIC, InputEnum::DEFINITION_FLAPS_DECR},
+    {508, BASIC, InputEnum::DEFINITION_PITOT_HEAT_TOGGLE},
+    {509, BASIC, InputEnum::DEFINITION_PITOT_HEAT_ON},
+    {510, BASIC, InputEnum::DEFINITION_PITOT_HEAT_OFF},
+    {511, BASIC, InputEnum::DEFINITION_MAGNETO},
+    {512, BASIC, InputEnum::DEFINITION_MAGNETO_DECR},
+    {513, BASIC, InputEnum::DEFINITION_MAGNETO_INCR},
+    {514, BASIC, InputEnum::DEFINITION_MAGNETO1_OFF},
+    {515, BASIC, InputEnum::DEFINITION_MAGNETO1_RIGHT},
+    {516, BASIC, InputEnum::DEFINITION_MAGNETO1_LEFT},
+    {517, BASIC, InputEnum::DEFINITION_MAGNETO1_BOTH},
+    {518, BASIC, InputEnum::DEFINITION_MAGNETO1_START},
+    {519, BASIC, InputEnum::DEFINITION_MAGNETO2_OFF},
+    {520, BASIC, InputEnum::DEFINITION_MAGNETO2_RIGHT},
+    {521, BASIC, InputEnum::DEFINITION_MAGNETO2_LEFT},
+    {522, BASIC, InputEnum::DEFINITION_MAGNETO2_BOTH},
+    {523, BASIC, InputEnum::DEFINITION_MAGNETO2_START},
+    {524, BASIC, InputEnum::DEFINITION_MAGNETO3_OFF},
+    {525, BASIC, InputEnum::DEFINITION_MAGNETO3_RIGHT},
+    {526, BASIC, InputEnum::DEFINITION_MAGNETO3_LEFT},
+    {527, BASIC, InputEnum::DEFINITION_MAGNETO3_BOTH},
+    {528, BASIC, InputEnum::DEFINITION_MAGNETO3_START},
+    {529, BASIC, InputEnum::DEFINITION_MAGNETO4_OFF},
+    {530, BASIC, InputEnum::DEFINITION_MAGNETO4_RIGHT},
+    {531, BASIC, InputEnum::DEFINITION_MAGNETO4_LEFT},
+    {532, BASIC, InputEnum::DEFINITION_MAGNETO4_BOTH},
+    {533, BASIC, InputEnum::DEFINITION_MAGNETO4_START},
+    {534, BASIC, InputEnum::DEFINITION_MAGNETO_OFF},
+    {535, BASIC, InputEnum::DEFINITION_MAGNETO_RIGHT},
+    {536, BASIC, InputEnum::DEFINITION_MAGNETO_LEFT},
+    {537, BASIC, InputEnum::DEFINITION_MAGNETO_BOTH},
+    {538, BASIC, InputEnum::DEFINITION_MAGNETO_START},
+    {539, BASIC, InputEnum::DEFINITION_MAGNETO1_DECR},
+    {540, BASIC, InputEnum::DEFINITION_MAGNETO1_INCR},
+    {541, BASIC, InputEnum::DEFINITION_MAGNETO2_DECR},
+    {542, BASIC, InputEnum::DEFINITION_MAGNETO2_INCR},
+    {543, BASIC, InputEnum::DEFINITION_MAGNETO3_DECR},
+    {544, BASIC, InputEnum::DEFINITION_MAGNETO3_INCR},
+    {545, BASIC, InputEnum::DEFINITION_MAGNETO4_DECR},
+    {546, BASIC, InputEnum::DEFINITION_MAGNETO4_INCR},
+    // TO DO SET FUNCTION
+    {547, BASIC, InputEnum::DEFINITION_MAGNETO_SET},
+    // TO DO SET FUNCTION
+    {548, BASIC, InputEnum::DEFINITION_MAGNETO1_SET},
+    // TO DO SET FUNCTION
+    {549, BASIC, InputEnum::DEFINITION_MAGNETO2_SET},
+    // TO DO SET FUNCTION
+    {550, BASIC, InputEnum::DEFINITION_MAGNETO3_SET},
+    // TO DO SET FUNCTION
+    {551, BASIC, InputEnum::DEFINITION_MAGNETO4_SET},
+    {552, BASIC, InputEnum::DEFINITION_ANTI_ICE_ON},
+    {553, BASIC, InputEnum::DEFINITION_ANTI_ICE_OFF},
+    // TO DO SET FUNCTION
+    {554, BASIC, InputEnum::DEFINITION_ANTI_ICE_SET},
+    {555, BASIC, InputEnum::DEFINITION_ANTI_ICE_TOGGLE},
+    {556, BASIC, InputEnum::DEFINITION_ANTI_ICE_TOGGLE_ENG1},
+    {557, BASIC, InputEnum::DEFINITION_ANTI_ICE_TOGGLE_ENG2},
+    {558, BASIC, InputEnum::DEFINITION_ANTI_ICE_TOGGLE_ENG3},
+    {559, BASIC, InputEnum::DEFINITION_ANTI_ICE_TOGGLE_ENG4},
+    // TO DO SET FUNCTION
+    {560, BASIC, InputEnum::DEFINITION_ANTI_ICE_SET_ENG1},
+    // TO DO SET FUNCTION
+    {561, BASIC, InputEnum::DEFINITION_ANTI_ICE_SET_ENG2},
+    // TO DO SET FUNCTION
+    {562, BASIC, InputEnum::DEFINITION_ANTI_ICE_SET_ENG3},
+    // TO DO SET FUNCTION
+    {563, BASIC, InputEnum::DEFINITION_ANTI_ICE_SET_ENG4},
+    {564, BASIC, InputEnum::DEFINITION_TOGGLE_FUEL_VALVE_ALL},
+    {565, BASIC, InputEnum::DEFINITION_TOGGLE_FUEL_VALVE_ENG1},
+    {566, BASIC, InputEnum::DEFINITION_TOGGLE_FUEL_VALVE_ENG2},
+    {567, BASIC, InputEnum::DEFINITION_TOGGLE_FUEL_VALVE_ENG3},
+    {568, BASIC, InputEnum::DEFINITION_TOGGLE_FUEL_VALVE_ENG4},
+    {569, BASIC, InputEnum::DEFINITION_FUEL_SELECTOR_OFF},
+    {570, BASIC, InputEnum::DEFINITION_FUEL_SELECTOR_ALL},
+    {571, BASIC, InputEnum::DEFINITION_FUEL_SELECTOR_LEFT},
+    {572, BASIC, InputEnum::DEFINITION_FUEL_SELECTOR_RIGHT},
+    {573, BASIC, InputEnum::DEFINITION_FUEL_SELECTOR_LEFT_AUX},
+    {574, BASIC, InputEnum::DEFINITION_FUEL_SELECTOR_RIGHT_AUX},
+    {575, BASIC, InputEnum::DEFINITION_FUEL_SELECTOR_CENTER},
+    // TO DO SET FUEL SELECTOR
+    {576, BASIC, InputEnum::DEFINITION_FUEL_SELECTOR_SET},
+    {577, BASIC, InputEnum::DEFINITION_FUEL_SELECTOR_2_OFF},
+    {578, BASIC, InputEnum::DEFINITION_FUEL_SELECTOR_2_ALL},
+    {579, BASIC, InputEnum::DEFINITION_FUEL_SELECTOR_2_LEFT},
+    {580, BASIC, InputEnum::DEFINITION_FUEL_SELECTOR_2_RIGHT},
+    {581, BASIC, InputEnum::DEFINITION_FUEL_SELECTOR_2_LEFT_AUX},
+    {582, BASIC, InputEnum::DEFINITION_FUEL_SELECTOR_2_RIGHT_AUX},
+    {583, BASIC, InputEnum::DEFINITION_FUEL_SELECTOR_2_CENTER},
+    // TO DO SET FUNCTION
+    {584, BASIC, InputEnum::DEFINITION_FUEL_SELECTOR_2_SET},
+    {585, BASIC, InputEnum::DEFINITION_FUEL_SELECTOR_3_OFF},
+    {586, BASIC, InputEnum::DEFINITION_FUEL_SELECTOR_3_ALL},
+    {587, BASIC, InputEnum::DEFINITION_FUEL_SELECTOR_3_LEFT},
+    {588, BASIC, InputEnum::DEFINITION_FUEL_SELECTOR_3_RIGHT},
+    {589, BASIC, InputEnum::DEFINITION_FUEL_SELECTOR_3_LEFT_AUX},
+    {590, BASIC, InputEnum::DEFINITION_FUEL_SELECTOR_3_RIGHT_AUX},
+    {591, BASIC, InputEnum::DEFINITION_FUEL_SELECTOR_3_CENTER},
+    // TO DO SET FUNCTION
+    {592, BASIC, InputEnum::DEFINITION_FUEL_SELECTOR_3_SET},
+    {593, BASIC, InputEnum::DEFINITION_FUEL_SELECTOR_4_OFF},
+    {594, BASIC, InputEnum::DEFINITION_FUEL_SELECTOR_4_ALL},
+    {595, BASIC, InputEnum::DEFINITION_FUEL_SELECTOR_4_LEFT},
+    {596, BASIC, InputEnum::DEFINITION_FUEL_SELECTOR_4_RIGHT},
+    {597, BASIC, InputEnum::DEFINITION_FUEL_SELECTOR_4_LEFT_AUX},
+    {598, BASIC, InputEnum::DEFINITION_FUEL_SELECTOR_4_RIGHT_AUX},
+    {599, BASIC, InputEnum::DEFINITION_FUEL_SELECTOR_4_CENTER},
+    // TO DO SET FUNCTION
+    {600, BASIC, InputEnum::DEFINITION_FUEL_SELECTOR_4_SET},
+    {601, BASIC, InputEnum::DEFINITION_CROSS_FEED_OPEN},
+    {602, BASIC, InputEnum::DEFINITION_CROSS_FEED_TOGGLE},
+    {603, BASIC, InputEnum::DEFINITION_CROSS_FEED_OFF},
+    {604, BASIC, InputEnum::DEFINITION_ELEV_TRIM_DN},
+    {605, BASIC, InputEnum::DEFINITION_DOWN},
+    {606, BASIC, InputEnum::DEFINITION_ELEV_TRIM_UP},
+    {607, BASIC, InputEnum::DEFINITION_ELEV_UP},
+    {608, BASIC, InputEnum::DEFINITION_SPOILERS_ARM_TOGGLE},
+    {609, BASIC, InputEnum::DEFINITION_SPOILERS_ON},
+    {610, BASIC, InputEnum::DEFINITION_SPOILERS_OFF},
+    {611, BASIC, InputEnum::DEFINITION_SPOILERS_ARM_ON},
+    {612, BASIC, InputEnum::DEFINITION_SPOILERS_ARM_OFF},
+    {613, BASIC, InputEnum::DEFINITION_AILERON_TRIM_LEFT},
+    {614, BASIC, InputEnum::DEFINITION_AILERON_TRIM_RIGHT},
+    {615, BASIC, InputEnum::DEFINITION_RUDDER_TRIM_LEFT},
+    {616, BASIC, InputEnum::DEFINITION_RUDDER_TRIM_RIGHT},
+    // TO DO SET FUNCTION
+    {617, BASIC, InputEnum::DEFINITION_COWLFLAP1_SET},
+    // TO DO SET FUNCTION
+    {618, BASIC, InputEnum::DEFINITION_COWLFLAP2_SET},
+    // TO DO SET FUNCTION
+    {619, BASIC, InputEnum::DEFINITION_COWLFLAP3_SET},
+    // TO DO SET FUNCTION
+    {620, BASIC, InputEnum::DEFINITION_COWLFLAP4_SET},
+    {621, BASIC, InputEnum::DEFINITION_INC_COWL_FLAPS},
+    {622, BASIC, InputEnum::DEFINITION_DEC_COWL_FLAPS},
+    {623, BASIC, InputEnum::DEFINITION_INC_COWL_FLAPS1},
+    {624, BASIC, InputEnum::DEFINITION_DEC_COWL_FLAPS1},
+    {625, BASIC, InputEnum::DEFINITION_INC_COWL_FLAPS2},
+    {626, BASIC, InputEnum::DEFINITION_DEC_COWL_FLAPS2},
+    {627, BASIC, InputEnum::DEFINITION_INC_COWL_FLAPS3},
+    {628, BASIC, InputEnum::DEFINITION_DEC_COWL_FLAPS3},
+    {629, BASIC, InputEnum::DEFINITION_INC_COWL_FLAPS4},
+    {630, BASIC, InputEnum::DEFINITION_DEC_COWL_FLAPS4},
+    {631, BASIC, InputEnum::DEFINITION_FUEL_PUMP},
+    {632, BASIC, InputEnum::DEFINITION_TOGGLE_ELECT_FUEL_PUMP},
+    {633, BASIC, InputEnum::DEFINITION_TOGGLE_ELECT_FUEL_PUMP1},
+    {634, BASIC, InputEnum::DEFINITION_TOGGLE_ELECT_FUEL_PUMP2},
+    {635, BASIC, InputEnum::DEFINITION_TOGGLE_ELECT_FUEL_PUMP3},
+    {636, BASIC, InputEnum::DEFINITION_TOGGLE_ELECT_FUEL_PUMP4},
+    {637, BASIC, InputEnum::DEFINITION_ENGINE_PRIMER},
+    {638, BASIC, InputEnum::DEFINITION_TOGGLE_PRIMER},
+    {639, BASIC, InputEnum::DEFINITION_TOGGLE_PRIMER1},
+    {640, BASIC, InputEnum::DEFINITION_TOGGLE_PRIMER2},
+    {641, BASIC, InputEnum::DEFINITION_TOGGLE_PRIMER3},
+    {642, BASIC, InputEnum::DEFINITION_TOGGLE_PRIMER4},
+    {643, BASIC, InputEnum::DEFINITION_TOGGLE_FEATHER_SWITCHES},
+    {644, BASIC, InputEnum::DEFINITION_TOGGLE_FEATHER_SWITCH_1},
+    {645, BASIC, InputEnum::DEFINITION_TOGGLE_FEATHER_SWITCH_2},
+    {646, BASIC, InputEnum::DEFINITION_TOGGLE_FEATHER_SWITCH_3},
+    {647, BASIC, InputEnum::DEFINITION_TOGGLE_FEATHER_SWITCH_4},
+    {648, BASIC, InputEnum::DEFINITION_TOGGLE_PROPELLER_SYNC},
+    {649, BASIC, InputEnum::DEFINITION_TOGGLE_AUTOFEATHER_ARM},
+    {650, BASIC, InputEnum::DEFINITION_TOGGLE_AFTERBURNER},
+    {651, BASIC, InputEnum::DEFINITION_TOGGLE_AFTERBURNER1},
+    {652, BASIC, InputEnum::DEFINITION_TOGGLE_AFTERBURNER2},
+    {653, BASIC, InputEnum::DEFINITION_TOGGLE_AFTERBURNER3},
+    {654, BASIC, InputEnum::DEFINITION_TOGGLE_AFTERBURNER4},
+    {655, BASIC, InputEnum::DEFINITION_ENGINE},
+    {656, BASIC, InputEnum::DEFINITION_SPOILERS_TOGGLE},
+    {657, BASIC, InputEnum::DEFINITION_TOGGLE_STARTER1},
+    {658, BASIC, InputEnum::DEFINITION_TOGGLE_STARTER2},
+    {659, BASIC, InputEnum::DEFINITION_TOGGLE_STARTER3},
+    {660, BASIC, InputEnum::DEFINITION_TOGGLE_STARTER4},
+    {661, BASIC, InputEnum::DEFINITION_TOGGLE_ALL_STARTERS},
+    {662, BASIC, InputEnum::DEFINITION_ENGINE_AUTO_START},
+    {663, BASIC, InputEnum::DEFINITION_ENGINE_AUTO_SHUTDOWN},
+    {664, BASIC, InputEnum::DEFINITION_FUEL_SELECTOR_LEFT_MAIN},
+    {665, BASIC, InputEnum::DEFINITION_FUEL_SELECTOR_2_LEFT_MAIN},
+    {666, FUEL_SELECTOR_SMOKE, InputEnum::DEFINITION_FUEL_SELECTOR_3_LEFT_MAIN},
+    {667, BASIC, InputEnum::DEFINITION_FUEL_SELECTOR_4_LEFT_MAIN},
+    {668, BASIC, InputEnum::DEFINITION_FUEL_SELECTOR_RIGHT_MAIN},
+    {669, BASIC, InputEnum::DEFINITION_FUEL_SELECTOR_2_RIGHT_MAIN},
+    {670, BASIC, InputEnum::DEFINITION_FUEL_SELECTOR_3_RIGHT_MAIN},
+    {671, BASIC, InputEnum::DEFINITION_FUEL_SELECTOR_4_RIGHT_MAIN},
+    {672, BASIC, InputEnum::DEFINITION_APU_STARTER},
+    {673, BASIC, InputEnum::DEFINITION_APU_OFF_SWITCH},
+    {674, BASIC, InputEnum::DEFINITION_APU_GENERATOR_SWITCH_TOGGLE},
+    {675, BASIC, InputEnum::DEFINITION_CABIN_NO_SMOKING_ALERT_SWITCH_TOGGLE},
+    {676, BASIC, InputEnum::DEFINITION_CABIN_SEATBELTS_ALERT_SWITCH_TOGGLE},
+    {677, BASIC, InputEnum::DEFINITION_STROBES_TOGGLE},
+    {678, BASIC, InputEnum::DEFINITION_ALL_LIGHTS_TOGGLE},
+    {679, BASIC, InputEnum::DEFINITION_PANEL_LIGHTS_TOGGLE},
+    {680, BASIC, InputEnum::DEFINITION_LANDING_LIGHTS_TOGGLE},
+    {681, BASIC, InputEnum::DEFINITION_LANDING_LIGHT_UP},
+    {682, BASIC, InputEnum::DEFINITION_LANDING_LIGHT_DOWN},
+    {683, BASIC, InputEnum::DEFINITION_LANDING_LIGHT_LEFT},
+    {684, BASIC, InputEnum::DEFINITION_LANDING_LIGHT_RIGHT},
+    {685, BASIC, InputEnum::DEFINITION_LANDING_LIGHT_HOME},
+    {686, BASIC, InputEnum::DEFINITION_STROBES_ON},
+    {687, BASIC, InputEnum::DEFINITION_STROBES_OFF},
+    {688, BASIC, InputEnum::DEFINITION_PANEL_LIGHTS_ON},
+    {689, BASIC, InputEnum::DEFINITION_PANEL_LIGHTS_OFF},
+    {690, BASIC, InputEnum::DEFINITION_LANDING_LIGHTS_ON},
+    {691, BASIC, InputEnum::DEFINITION_LANDING_LIGHTS_OFF},
+    {692, BASIC, InputEnum::DEFINITION_TOGGLE_BEACON_LIGHTS},
+    {693, BASIC, InputEnum::DEFINITION_TOGGLE_TAXI_LIGHTS},
+    {694, BASIC, InputEnum::DEFINITION_TOGGLE_LOGO_LIGHTS},
+    {695, BASIC, InputEnum::DEFINITION_TOGGLE_RECOGNITION_LIGHTS},
+    {696, BASIC, InputEnum::DEFINITION_TOGGLE_WING_LIGHTS},
+    {697, BASIC, InputEnum::DEFINITION_TOGGLE_NAV_LIGHTS},
+    {698, BASIC, InputEnum::DEFINITION_TOGGLE_CABIN_LIGHTS},
+    {699, BASIC, InputEnum::DEFINITION_GEAR_UP},
+    {700, BASIC, InputEnum::DEFINITION_GEAR_DOWN},
+    {701, BASIC, InputEnum::DEFINITION_TOGGLE_STRUCTURAL_DEICE},
+    {702, BASIC, InputEnum::DEFINITION_TOGGLE_PROPELLER_DEICE},
+    {703, BASIC, InputEnum::DEFINITION_TOGGLE_ALTERNATOR1},
+    {704, BASIC, InputEnum::DEFINITION_TOGGLE_ALTERNATOR2},
+    {705, BASIC, InputEnum::DEFINITION_TOGGLE_ALTERNATOR3},
+    {706, BASIC, InputEnum::DEFINITION_TOGGLE_ALTERNATOR4},
+    {707, BASIC, InputEnum::DEFINITION_ATC},
+    {708, BASIC, InputEnum::DEFINITION_ATC_MENU_1},
+    {709, BASIC, InputEnum::DEFINITION_ATC_MENU_2},
+    {710, BASIC, InputEnum::DEFINITION_ATC_MENU_3},
+    {711, BASIC, InputEnum::DEFINITION_ATC_MENU_4},
+    {712, BASIC, InputEnum::DEFINITION_ATC_MENU_5},
+    {713, BASIC, InputEnum::DEFINITION_ATC_MENU_6},
+    {714, BASIC, InputEnum::DEFINITION_ATC_MENU_7},
+    {715, BASIC, InputEnum::DEFINITION_ATC_MENU_8},
+    {716, BASIC, InputEnum::DEFINITION_ATC_MENU_9},
+    {717, BASIC, InputEnum::DEFINITION_ATC_MENU_0},
+    {718, BASIC, InputEnum::DEFINITION_EGT1_INC},
+    {719, BASIC, InputEnum::DEFINITION_EGT1_DEC},
+    {720, BASIC, InputEnum::DEFINITION_EGT2_INC},
+    {721, BASIC, InputEnum::DEFINITION_EGT2_DEC},
+    {722, BASIC, InputEnum::DEFINITION_EGT3_INC},
+    {723, BASIC, InputEnum::DEFINITION_EGT3_DEC},
+    {724, BASIC, InputEnum::DEFINITION_EGT4_INC},
+    {725, BASIC, InputEnum::DEFINITION_EGT4_DEC},
+    {726, BASIC, InputEnum::DEFINITION_EGT_INC},
+    {727, BASIC, InputEnum::DEFINITION_EGT_DEC},
+    {728, BASIC, InputEnum::DEFINITION_TOGGLE_GPS_DRIVES_NAV1},
+    {729, BASIC, InputEnum::DEFINITION_GPS_POWER_BUTTON},
+    {730, BASIC, InputEnum::DEFINITION_GPS_NEAREST_BUTTON},
+    {731, BASIC, InputEnum::DEFINITION_GPS_OBS_BUTTON},
+    {732, BASIC, InputEnum::DEFINITION_GPS_MSG_BUTTON},
+    {733, BASIC, InputEnum::DEFINITION_GPS_MSG_BUTTON_DOWN},
+    {734, BASIC, InputEnum::DEFINITION_GPS_MSG_BUTTON_UP},
+    {735, BASIC, InputEnum::DEFINITION_GPS_FLIGHTPLAN_BUTTON},
+    {736, BASIC, InputEnum::DEFINITION_GPS_TERRAIN_BUTTON},
+    {737, BASIC, InputEnum::DEFINITION_GPS_PROCEDURE_BUTTON},
+    {738, BASIC, InputEnum::DEFINITION_GPS_ZOOMIN_BUTTON},
+    {739, BASIC, InputEnum::DEFINITION_GPS_ZOOMOUT_BUTTON},
+    {740, BASIC, InputEnum::DEFINITION_GPS_DIRECTTO_BUTTON},
+    {741, BASIC, InputEnum::DEFINITION_GPS_MENU_BUTTON},
+    {742, BASIC, InputEnum::DEFINITION_GPS_CLEAR_BUTTON},
+    {743, BASIC, InputEnum::DEFINITION_GPS_CLEAR_ALL_BUTTON},
+    {744, BASIC, InputEnum::DEFINITION_GPS_CLEAR_BUTTON_DOWN},
+    {745, BASIC, InputEnum::DEFINITION_GPS_CLEAR_BUTTON_UP},
+    {746, BASIC, InputEnum::DEFINITION_GPS_ENTER_BUTTON},
+    {747, BASIC, InputEnum::DEFINITION_GPS_CURSOR_BUTTON},
+    {748, BASIC, InputEnum::DEFINITION_GPS_GROUP_KNOB_INC},
+    {749, BASIC, InputEnum::DEFINITION_GPS_GROUP_KNOB_DEC},
+    {750, BASIC, InputEnum::DEFINITION_GPS_PAGE_KNOB_INC},
+    {751, BASIC, InputEnum::DEFINITION_GPS_PAGE_KNOB_DEC},
+    {752, BASIC, InputEnum::DEFINITION_YAW_DAMPER_TOGGLE},
+    {803, ENCODER, InputEnum::DEFINITION_AP_MAX_BANK_INC, 1},
+    {804, ENCODER, InputEnum::DEFINITION_AP_MAX_BANK_DEC, -1},
+    {805, ENCODER, InputEnum::DEFINITION_GYRO_DRIFT_INC, 1},
+    {806, ENCODER, InputEnum::DEFINITION_GYRO_DRIFT_DEC, -1},
+    {807, ENCODER, InputEnum::DEFINITION_TRUE_AIRSPEED_CAL_INC, 1},
+    {808, ENCODER, InputEnum::DEFINITION_TRUE_AIRSPEED_CAL_DEC, -1},
+    {809, ENCODER, InputEnum::DEFINITION_DECREASE_DECISION_HEIGHT, -1},
+    {810, ENCODER, InputEnum::DEFINITION_INCREASE_DECISION_HEIGHT, 1},
+    {908, BASIC, InputEnum::DEFINITION_SIM_PAUSE_ON},
+    {909, BASIC, InputEnum::DEFINITION_SIM_PAUSE_OFF},
+    {900, ELEVATOR_TRIM},
+    {901, RUDDER},
+    {902, BRAKES},
+};
+
+constexpr bool rowsAreValid() {
+  for (const auto &row : rows) {
+    if (row.prefix < 0 || row.prefix > maxPrefix) {
+      return false;
+    }
+  }
+  for (const auto &row : rows) {
+    int found = 0;
+    for (const auto &other : rows) {
+      if (other.prefix == row.prefix) {
+        found++;
+      }
+    }
+    if (found != 1) {
+      return false;
+    }
+  }
+  return true;
+}
+static_assert(rowsAreValid(), "Input prefixes must be unique and <= 9999");
+
+constexpr std::array<Entry, maxPrefix + 1> buildTable() {
+  std::array<Entry, maxPrefix + 1> table{};
+  for (const auto &row : rows) {
+    table[row.prefix] = {row.kind, static_cast<int8_t>(row.value),
+                         static_cast<uint16_t>(row.event)};
+  }
+  return table;
+}
+
+inline constexpr std::array<Entry, maxPrefix + 1> table = buildTable();
+
+// Out of range prefixes land on entry 0, which is never mapped
+inline const Entry &lookup(int prefix) {
+  return table[static_cast<unsigned>(prefix) <= maxPrefix ? prefix : 0];
+}
+
+}  // namespace inputdispatch
+
+#endif  // INPUTDISPATCHTABLE_H
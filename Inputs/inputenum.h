@@ -53,6 +53,8 @@ class InputEnum {
     DEFINITION_COM2_RADIO_FRACT_DEC_CARRY,
     DEFINITION_COM2_RADIO_FRACT_INC_CARRY,
     DEFINITION_COM_RADIO_FRACT_INC_CARRY,
+    DEFINITION_COM_STBY_RADIO_SET_HZ,
+    DEFINITION_COM2_STBY_RADIO_SET_HZ,
 
     // Nav
     DEFINITION_NAV_1_RADIO_FRACT_INC,
@@ -63,6 +65,8 @@ class InputEnum {
     DEFINITION_NAV_1_RADIO_WHOLE_DEC,
     DEFINITION_NAV_2_RADIO_WHOLE_INC,
     DEFINITION_NAV_2_RADIO_WHOLE_DEC,
+    DEFINITION_NAV1_STBY_SET_HZ,
+    DEFINITION_NAV2_STBY_SET_HZ,
 
     // DME
     DEFINITION_RADIO_SELECTED_DME1_IDENT_ENABLE,
@@ -89,6 +93,8 @@ class InputEnum {
     DEFINITION_VOR1_OBI_INC,
     DEFINITION_VOR2_OBI_DEC,
     DEFINITION_VOR2_OBI_INC,
+    DEFINITION_VOR1_SET,
+    DEFINITION_VOR2_SET,
 
     // ADF
     DEFINITION_RADIO_SELECTED_ADF_IDENT_ENABLE,
@@ -231,6 +237,7 @@ class InputEnum {
     DEFINITION_AP_NAV1_HOLD,
     DEFINITION_HEADING_BUG_INC,
     DEFINITION_HEADING_BUG_DEC,
+    DEFINITION_HEADING_BUG_SET,
     DEFINITION_TOGGLE_FLIGHT_DIRECTOR,
     DEFINITION_AP_VS_HOLD,
     DEFINITION_KOHLSMAN_INC,
@@ -564,6 +571,10 @@ class InputEnum {
     DEFINITION_TRUE_AIRSPEED_CAL_DEC,
     DEFINITION_DECREASE_DECISION_HEIGHT,
     DEFINITION_INCREASE_DECISION_HEIGHT,
+    DEFINITION_AP_MAX_BANK_SET,
+    DEFINITION_GYRO_DRIFT_SET,
+    DEFINITION_TRUE_AIRSPEED_CAL_SET,
+    DEFINITION_DECISION_HEIGHT_SET,
     DEFINITION_ELEVATOR_TRIM_SET,
     DEFINITION_SIM_PAUSE_ON,
     DEFINITION_SIM_PAUSE_OFF,
@@ -578,6 +589,8 @@ class InputEnum {
     DEFINITION_CRJ_SMOKE_ON,
     DEFINITION_CRJ_SMOKE_OFF,
     EVENT_WASM,
+    // System event used to flush the axes once per sim frame
+    EVENT_AXIS_FRAME,
 
   };
 };
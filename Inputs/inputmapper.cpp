@@ -541,6 +541,8 @@ void InputMapper::mapEvents(HANDLE mapConnect) {
       mapConnect, definitionsMap.DEFINITION_HEADING_BUG_INC, "HEADING_BUG_INC");
   SimConnect_MapClientEventToSimEvent(
       mapConnect, definitionsMap.DEFINITION_HEADING_BUG_DEC, "HEADING_BUG_DEC");
+  SimConnect_MapClientEventToSimEvent(
+      mapConnect, definitionsMap.DEFINITION_HEADING_BUG_SET, "HEADING_BUG_SET");
   SimConnect_MapClientEventToSimEvent(
       mapConnect, definitionsMap.DEFINITION_TOGGLE_FLIGHT_DIRECTOR,
       "TOGGLE_FLIGHT_DIRECTOR");
@@ -601,6 +603,12 @@ void InputMapper::mapEvents(HANDLE mapConnect) {
   SimConnect_MapClientEventToSimEvent(
       mapConnect, definitionsMap.DEFINITION_COM2_RADIO_FRACT_INC_CARRY,
       "COM2_RADIO_FRACT_INC_CARRY");
+  SimConnect_MapClientEventToSimEvent(
+      mapConnect, definitionsMap.DEFINITION_COM_STBY_RADIO_SET_HZ,
+      "COM_STBY_RADIO_SET_HZ");
+  SimConnect_MapClientEventToSimEvent(
+      mapConnect, definitionsMap.DEFINITION_COM2_STBY_RADIO_SET_HZ,
+      "COM2_STBY_RADIO_SET_HZ");
 
   SimConnect_MapClientEventToSimEvent(
       mapConnect, definitionsMap.DEFINITION_NAV_1, "NAV1_RADIO_SET");
@@ -630,6 +638,12 @@ void InputMapper::mapEvents(HANDLE mapConnect) {
   SimConnect_MapClientEventToSimEvent(
       mapConnect, definitionsMap.DEFINITION_NAV_2_RADIO_WHOLE_DEC,
       "NAV2_RADIO_WHOLE_DEC");
+  SimConnect_MapClientEventToSimEvent(
+      mapConnect, definitionsMap.DEFINITION_NAV1_STBY_SET_HZ,
+      "NAV1_STBY_SET_HZ");
+  SimConnect_MapClientEventToSimEvent(
+      mapConnect, definitionsMap.DEFINITION_NAV2_STBY_SET_HZ,
+      "NAV2_STBY_SET_HZ");
 
   SimConnect_MapClientEventToSimEvent(
       mapConnect, definitionsMap.DEFINITION_COM_STANDBY_SWAP,
@@ -714,6 +728,10 @@ void InputMapper::mapEvents(HANDLE mapConnect) {
       mapConnect, definitionsMap.DEFINITION_VOR2_OBI_DEC, "VOR2_OBI_DEC");
   SimConnect_MapClientEventToSimEvent(
       mapConnect, definitionsMap.DEFINITION_VOR2_OBI_INC, "VOR2_OBI_INC");
+  SimConnect_MapClientEventToSimEvent(
+      mapConnect, definitionsMap.DEFINITION_VOR1_SET, "VOR1_SET");
+  SimConnect_MapClientEventToSimEvent(
+      mapConnect, definitionsMap.DEFINITION_VOR2_SET, "VOR2_SET");
 
   // ADF
   SimConnect_MapClientEventToSimEvent(
@@ -1387,6 +1405,16 @@ void InputMapper::mapEvents(HANDLE mapConnect) {
   SimConnect_MapClientEventToSimEvent(
       mapConnect, definitionsMap.DEFINITION_INCREASE_DECISION_HEIGHT,
       "INCREASE_DECISION_HEIGHT");
+  SimConnect_MapClientEventToSimEvent(
+      mapConnect, definitionsMap.DEFINITION_AP_MAX_BANK_SET, "AP_MAX_BANK_SET");
+  SimConnect_MapClientEventToSimEvent(
+      mapConnect, definitionsMap.DEFINITION_GYRO_DRIFT_SET, "GYRO_DRIFT_SET");
+  SimConnect_MapClientEventToSimEvent(
+      mapConnect, definitionsMap.DEFINITION_TRUE_AIRSPEED_CAL_SET,
+      "TRUE_AIRSPEED_CAL_SET");
+  SimConnect_MapClientEventToSimEvent(
+      mapConnect, definitionsMap.DEFINITION_DECISION_HEIGHT_SET,
+      "DECISION_HEIGHT_SET");
   SimConnect_MapClientEventToSimEvent(
       mapConnect, definitionsMap.DEFINITION_ELEVATOR_TRIM_SET,
       "ELEVATOR_TRIM_SET");
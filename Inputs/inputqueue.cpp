@@ -0,0 +1,87 @@
+#include "inputqueue.h"
+
+#include <headers/WakeEvent.h>
+
+#include <algorithm>
+
+InputQueue::InputQueue() : wakeEvent(createWakeEvent()) {
+  for (size_t i = 0; i < capacity; i++) {
+    cells[i].sequence.store(i, std::memory_order_relaxed);
+  }
+}
+
+InputQueue::~InputQueue() { closeWakeEvent(wakeEvent); }
+
+bool InputQueue::push(const InputRecord &record) {
+  size_t pos = enqueuePos.load(std::memory_order_relaxed);
+  Cell *cell;
+  for (;;) {
+    cell = &cells[pos & (capacity - 1)];
+    const size_t sequence = cell->sequence.load(std::memory_order_acquire);
+    const auto diff = static_cast<std::ptrdiff_t>(sequence) -
+                      static_cast<std::ptrdiff_t>(pos);
+    if (diff == 0) {
+      if (enqueuePos.compare_exchange_weak(pos, pos + 1,
+                                           std::memory_order_relaxed)) {
+        break;
+      }
+    } else if (diff < 0) {
+      dropped.fetch_add(1, std::memory_order_relaxed);
+      return false;
+    } else {
+      pos = enqueuePos.load(std::memory_order_relaxed);
+    }
+  }
+  cell->record = record;
+  cell->sequence.store(pos + 1, std::memory_order_seq_cst);
+
+  if (consumerWaiting.load(std::memory_order_seq_cst)) {
+    signalWakeEvent(wakeEvent);
+  }
+  return true;
+}
+
+bool InputQueue::pop(InputRecord *record) {
+  const size_t pos = dequeuePos.load(std::memory_order_relaxed);
+  Cell &cell = cells[pos & (capacity - 1)];
+  if (cell.sequence.load(std::memory_order_acquire) != pos + 1) {
+    return false;
+  }
+  *record = cell.record;
+  cell.sequence.store(pos + capacity, std::memory_order_release);
+  dequeuePos.store(pos + 1, std::memory_order_relaxed);
+  return true;
+}
+
+void InputQueue::waitForRecords(unsigned long timeoutMs,
+                                const SerialPort::NativeHandle *wakeHandles,
+                                int wakeCount) {
+  std::array<SerialPort::NativeHandle, maxWakeHandles + 1> handles;
+  wakeCount = std::clamp(wakeCount, 0, maxWakeHandles);
+  std::copy(wakeHandles, wakeHandles + wakeCount, handles.begin());
+  handles[wakeCount] = wakeEvent;
+
+  // A producer either sees the flag and signals the event, or its record
+  // is seen here before the wait
+  consumerWaiting.store(true, std::memory_order_seq_cst);
+  if (!hasRecord()) {
+    SerialPort::waitForData(nullptr, 0, timeoutMs, handles.data(),
+                            wakeCount + 1);
+  }
+  consumerWaiting.store(false, std::memory_order_relaxed);
+  // The consumer drains the queue next, a signal for a record it is about
+  // to pop isn't needed anymore
+  resetWakeEvent(wakeEvent);
+}
+
+bool InputQueue::hasRecord() const {
+  const size_t pos = dequeuePos.load(std::memory_order_relaxed);
+  return cells[pos & (capacity - 1)].sequence.load(
+             std::memory_order_seq_cst) == pos + 1;
+}
+
+size_t InputQueue::depth() const {
+  // Read the consumer side first, the producers only ever move ahead of it
+  const size_t dequeued = dequeuePos.load(std::memory_order_relaxed);
+  return enqueuePos.load(std::memory_order_relaxed) - dequeued;
+}
@@ -0,0 +1,72 @@
+#ifndef INPUTQUEUE_H
+#define INPUTQUEUE_H
+
+#include <headers/SerialPort.hpp>
+
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+
+#include "inputcommand.h"
+
+// A parsed command together with the board it came from
+struct InputRecord {
+  InputCommand command;
+  uint16_t port = 0;
+};
+
+// Bounded lock-free queue between the per-port readers (any number of
+// producers) and the thread that talks to SimConnect (a single consumer).
+// Every cell carries a sequence number that tells producers and the consumer
+// whose turn it is, so neither side takes a lock to move records.
+class InputQueue {
+ public:
+  static constexpr size_t capacity = 1024;
+  // Handles waitForRecords() waits on next to the queue
+  static constexpr int maxWakeHandles = 3;
+
+  InputQueue();
+  ~InputQueue();
+
+  // Returns false and counts the record as dropped when the queue is full
+  bool push(const InputRecord &record);
+
+  // Consumer side only
+  bool pop(InputRecord *record);
+
+  // Blocks the consumer until a record is pushed, one of the wake handles
+  // is signalled or timeoutMs passed, so it can wait for SimConnect at the
+  // same time
+  void waitForRecords(unsigned long timeoutMs,
+                      const SerialPort::NativeHandle *wakeHandles = nullptr,
+                      int wakeCount = 0);
+
+  size_t depth() const;
+
+  uint64_t droppedRecords() const {
+    return dropped.load(std::memory_order_relaxed);
+  }
+
+ private:
+  static_assert((capacity & (capacity - 1)) == 0,
+                "InputQueue capacity must be a power of two");
+
+  struct Cell {
+    std::atomic<size_t> sequence;
+    InputRecord record;
+  };
+
+  std::array<Cell, capacity> cells;
+  alignas(64) std::atomic<size_t> enqueuePos{0};
+  alignas(64) std::atomic<size_t> dequeuePos{0};
+  std::atomic<uint64_t> dropped{0};
+
+  bool hasRecord() const;
+
+  // Only used to sleep while the queue is empty, never to move records
+  std::atomic<bool> consumerWaiting{false};
+  SerialPort::NativeHandle wakeEvent;
+};
+
+#endif  // INPUTQUEUE_H
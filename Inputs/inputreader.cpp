@@ -0,0 +1,97 @@
+#include "inputreader.h"
+
+#include <headers/constants.h>
+
+#include <iostream>
+#include <string_view>
+
+void InputReaders::start(const std::vector<SerialPort *> &ports) {
+  stop();
+  if (ports.size() != portCount) {
+    portCount = ports.size();
+    stats = std::make_unique<InputPortStats[]>(portCount);
+    reportedLines.assign(portCount, 0);
+    reportedBytes.assign(portCount, 0);
+  }
+  running = true;
+  lostPorts = 0;
+  // Ports that failed to open get a reader as well, it keeps trying to
+  // open them
+  for (size_t i = 0; i < portCount; i++) {
+    threads.emplace_back(&InputReaders::readPort, this, ports[i],
+                         static_cast<int>(i));
+  }
+}
+
+void InputReaders::stop() {
+  running = false;
+  for (auto &thread : threads) {
+    thread.join();
+  }
+  threads.clear();
+}
+
+void InputReaders::readPort(SerialPort *port, int index) {
+  InputPortStats &portStats = stats[index];
+  InputRecord record;
+  record.port = static_cast<uint16_t>(index);
+  PortReconnector reconnector;
+  reconnector.watch({port});
+  bool lost = !port->isConnected();
+  if (lost) {
+    lostPorts.fetch_add(1, std::memory_order_relaxed);
+  }
+
+  while (running.load(std::memory_order_relaxed)) {
+    reconnector.poll();
+    if (reconnector.changed()) {
+      lost = !lost;
+      lostPorts.fetch_add(lost ? 1 : -1, std::memory_order_relaxed);
+    }
+    SerialPort::waitForData(&port, 1, constants::serialWaitTimeoutMs);
+    const int bytesRead = port->fillLineFramer();
+    if (bytesRead <= 0) {
+      continue;
+    }
+    portStats.bytes.fetch_add(bytesRead, std::memory_order_relaxed);
+
+    std::string_view line;
+    while (port->readLine(&line)) {
+      record.command = parseInputCommand(line);
+      portStats.lines.fetch_add(1, std::memory_order_relaxed);
+      if (!record.command.isValid()) {
+        if (record.command.status != InputCommand::EMPTY) {
+          portStats.rejected.fetch_add(1, std::memory_order_relaxed);
+        }
+        continue;
+      }
+      queue->push(record);
+    }
+  }
+}
+
+void InputReaders::report(double elapsedSeconds) {
+  for (size_t i = 0; i < portCount; i++) {
+    const uint64_t lines = stats[i].lines.load(std::memory_order_relaxed);
+    const uint64_t bytes = stats[i].bytes.load(std::memory_order_relaxed);
+    if (lines != reportedLines[i]) {
+      std::cout << "input port " << i << ": "
+                << (lines - reportedLines[i]) / elapsedSeconds << " lines/s "
+                << (bytes - reportedBytes[i]) / elapsedSeconds << " bytes/s "
+                << stats[i].rejected.load(std::memory_order_relaxed)
+                << " rejected" << std::endl;
+    }
+    reportedLines[i] = lines;
+    reportedBytes[i] = bytes;
+  }
+  // Quiet while the peak holds steady and nothing is lost, an idle or
+  // evenly loaded queue has nothing to tell
+  const uint64_t dropped = queue->droppedRecords();
+  if (maxDepth != reportedDepth || dropped != reportedDropped) {
+    std::cout << "input queue: peak depth " << maxDepth << ", "
+              << dropped - reportedDropped << " dropped" << std::endl;
+  }
+  reportedDropped = dropped;
+  reportedDepth = maxDepth;
+  maxDepth = 0;
+}
@@ -0,0 +1,68 @@
+#ifndef INPUTREADER_H
+#define INPUTREADER_H
+
+#include <headers/PortReconnector.h>
+#include <headers/SerialPort.hpp>
+
+#include <algorithm>
+#include <atomic>
+#include <cstdint>
+#include <memory>
+#include <thread>
+#include <vector>
+
+#include "inputqueue.h"
+
+// Counters of a single board, written by its reader thread and read by
+// whoever reports them
+struct InputPortStats {
+  std::atomic<uint64_t> bytes{0};
+  std::atomic<uint64_t> lines{0};
+  std::atomic<uint64_t> rejected{0};
+};
+
+// Runs one reader thread per input board. Each thread waits on its own port,
+// splits the data into lines, parses them and hands the commands to the
+// queue, so a slow or chatty board never holds up the others.
+class InputReaders {
+ public:
+  explicit InputReaders(InputQueue *queue) : queue(queue) {}
+  ~InputReaders() { stop(); }
+
+  // Sizes the counters for the given ports once and starts a reader for
+  // every port that is connected
+  void start(const std::vector<SerialPort *> &ports);
+  void stop();
+
+  const InputPortStats &portStats(int port) const { return stats[port]; }
+
+  // Boards that were unplugged and haven't been reopened yet, every reader
+  // brings its own board back
+  int disconnectedPorts() const {
+    return lostPorts.load(std::memory_order_relaxed);
+  }
+
+  // Called by the consumer before draining so report() can show the peak
+  void sampleDepth(size_t depth) { maxDepth = std::max(maxDepth, depth); }
+
+  // Prints throughput per port and, when it changed or records were dropped,
+  // the queue depth since the last report
+  void report(double elapsedSeconds);
+
+ private:
+  void readPort(SerialPort *port, int index);
+
+  InputQueue *queue;
+  std::vector<std::thread> threads;
+  std::atomic<bool> running{false};
+  std::atomic<int> lostPorts{0};
+  size_t portCount = 0;
+  std::unique_ptr<InputPortStats[]> stats;
+  std::vector<uint64_t> reportedLines;
+  std::vector<uint64_t> reportedBytes;
+  uint64_t reportedDropped = 0;
+  size_t reportedDepth = 0;
+  size_t maxDepth = 0;
+};
+
+#endif  // INPUTREADER_H
@@ -0,0 +1,137 @@
+// Calibrates random 10-bit samples with the float code the handler ran for
+// every sample before and with the tables from axiscurve, for the default
+// curve and a throttle with a reverse range.
+
+#include <Inputs/axiscurve.h>
+#include <settings/coordinates.h>
+
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <random>
+#include <vector>
+
+namespace {
+
+using Curve = std::vector<coordinates>;
+
+constexpr float closedAxis = -16383.0;
+constexpr float openAxis = 16383.0;
+
+// What the handler does with the axis value, kept cheap and impossible to
+// optimize away
+long long checksum = 0;
+
+int legacyMapCoordinates(int value, coordinates toMapMin,
+                         coordinates toMapMax) {
+  return toMapMin.getY() +
+         (toMapMax.getY() - toMapMin.getY()) *
+             ((value - toMapMin.getX()) / (toMapMax.getX() - toMapMin.getX()));
+}
+
+// InputSwitchHandler::calibratedRange before the tables
+int legacyCalibratedRange(int value, const Curve &curve) {
+  int axis = 0;
+
+  if (static_cast<float>(value) <= curve[1].getX()) {
+    axis = legacyMapCoordinates(value, curve[0], curve.at(1));
+  }
+  // minCurve
+  else if (static_cast<float>(value) < curve[2].getX()) {
+    axis = legacyMapCoordinates(value, curve[1], curve[2]);
+  }
+  // deadzone
+  else if (static_cast<float>(value) >= curve[2].getX() &&
+           static_cast<float>(value) <= curve[4].getX()) {
+    axis = 0;
+  } else if (static_cast<float>(value) <= curve[5].getX()) {
+    axis = legacyMapCoordinates(static_cast<float>(value), curve[4],
+                                curve[5]);
+  } else if (static_cast<float>(value) <= curve[6].getX()) {
+    axis = legacyMapCoordinates(static_cast<float>(value), curve[5],
+                                curve[6]);
+  }
+  return axis;
+}
+
+int legacyMapThrottleValueToAxis(int value, float reverse, float max,
+                                 int idleCutoff, float reverseAxis) {
+  int valueThrottle;
+  bool reversed = max < idleCutoff;
+
+  if ((reversed && idleCutoff - reverse < 0 && value >= idleCutoff) ||
+      (!reversed && idleCutoff - reverse > 0 && value <= idleCutoff)) {
+    valueThrottle =
+        reverseAxis + (closedAxis - reverseAxis) *
+                          ((value - reverse) / (idleCutoff - reverse));
+  } else {
+    valueThrottle =
+        closedAxis +
+        (openAxis - closedAxis) * ((value - idleCutoff) / (max - idleCutoff));
+  }
+  if (valueThrottle > 16383) {
+    return 16383;
+  }
+  return valueThrottle;
+}
+
+template <typename Calibrate>
+double nanosecondsPerSample(const std::vector<int> &samples, int rounds,
+                            Calibrate calibrate) {
+  const auto start = std::chrono::steady_clock::now();
+  for (int round = 0; round < rounds; round++) {
+    for (const int sample : samples) {
+      checksum += calibrate(sample);
+    }
+  }
+  const std::chrono::duration<double, std::nano> elapsed =
+      std::chrono::steady_clock::now() - start;
+  return elapsed.count() / (static_cast<double>(samples.size()) * rounds);
+}
+
+}  // namespace
+
+int main(int argc, char **argv) {
+  const int rounds = argc > 1 ? std::atoi(argv[1]) : 2000;
+
+  const Curve curve = {coordinates(0, -16383),  coordinates(250, -10000),
+                       coordinates(400, 0),     coordinates(500, 0),
+                       coordinates(600, 0),     coordinates(750, 10000),
+                       coordinates(1023, 16383)};
+  axiscurve::Table curveTable;
+  axiscurve::bakeCurve(curve, &curveTable);
+  axiscurve::Table throttleTable;
+  axiscurve::bakeThrottle(0, 1023, 200, -23000.0, &throttleTable);
+
+  // A pot wandering over its whole range
+  std::mt19937 random(7);
+  std::uniform_int_distribution<int> value(0, constants::axisResolution - 1);
+  std::vector<int> samples(4096);
+  for (auto &sample : samples) {
+    sample = value(random);
+  }
+
+  const double legacyCurve =
+      nanosecondsPerSample(samples, rounds, [&](int sample) {
+        return legacyCalibratedRange(sample, curve);
+      });
+  const double tableCurve =
+      nanosecondsPerSample(samples, rounds, [&](int sample) {
+        return axiscurve::lookup(curveTable, sample);
+      });
+  const double legacyThrottle =
+      nanosecondsPerSample(samples, rounds, [](int sample) {
+        return legacyMapThrottleValueToAxis(sample, 0, 1023, 200, -23000.0);
+      });
+  const double tableThrottle =
+      nanosecondsPerSample(samples, rounds, [&](int sample) {
+        return axiscurve::lookup(throttleTable, sample);
+      });
+
+  std::printf("%-20s %8.2f ns/sample\n", "curve, float", legacyCurve);
+  std::printf("%-20s %8.2f ns/sample\n", "curve, table", tableCurve);
+  std::printf("%-20s %8.2f ns/sample\n", "throttle, float", legacyThrottle);
+  std::printf("%-20s %8.2f ns/sample\n", "throttle, table", tableThrottle);
+  std::printf("checksum %lld\n", checksum);
+  return 0;
+}
@@ -0,0 +1,120 @@
+// Runs a noisy potentiometer trace through the ad hoc rules the yoke and
+// rudder handlers had before AxisFilter and through AxisFilter with each
+// stage and with the whole pipeline, and reports the time per sample.
+
+#include <Inputs/axisfilter.h>
+
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <random>
+#include <vector>
+
+namespace {
+
+// What the handler does with the filtered value, kept cheap and impossible
+// to optimize away
+long long checksum = 0;
+
+// controlYoke: a value under 10 only counted if the previous one was under
+// 20 as well
+struct LegacyYokeRule {
+  double old = 0;
+
+  int apply(int sample) {
+    if (sample < 10.0) {
+      if (old < 20.0) {
+        old = sample;
+      }
+    } else {
+      old = sample;
+    }
+    return static_cast<int>(old);
+  }
+};
+
+// setRudder: jumps of 10000 or more on the calibrated axis were dropped,
+// which is 312 raw steps
+struct LegacyRudderRule {
+  int old = 0;
+
+  int apply(int sample) {
+    if (std::abs(sample * 32 - old * 32) < 10000) {
+      old = sample;
+    }
+    return old;
+  }
+};
+
+template <typename Filter>
+double nanosecondsPerSample(const std::vector<int> &samples, int rounds,
+                            Filter filter) {
+  const auto start = std::chrono::steady_clock::now();
+  for (int round = 0; round < rounds; round++) {
+    for (const int sample : samples) {
+      checksum += filter.apply(sample);
+    }
+  }
+  const std::chrono::duration<double, std::nano> elapsed =
+      std::chrono::steady_clock::now() - start;
+  return elapsed.count() / (static_cast<double>(samples.size()) * rounds);
+}
+
+AxisFilter makeFilter(int medianWindow, int smoothing, int deadband,
+                      int slewLimit) {
+  AxisFilterSettings settings;
+  settings.medianWindow = medianWindow;
+  settings.smoothing = smoothing;
+  settings.deadband = deadband;
+  settings.slewLimit = slewLimit;
+  AxisFilter filter;
+  filter.configure(settings);
+  return filter;
+}
+
+}  // namespace
+
+int main(int argc, char **argv) {
+  const int rounds = argc > 1 ? std::atoi(argv[1]) : 2000;
+
+  // A lever moving slowly with noise and the odd spike
+  std::mt19937 random(11);
+  std::normal_distribution<double> jitter(0.0, 4.0);
+  std::vector<int> samples;
+  for (int i = 0; i < 4096; i++) {
+    const int value = static_cast<int>(512 + 400 * std::sin(i / 300.0) +
+                                       jitter(random));
+    samples.push_back(i % 97 == 0 ? 1023 : value);
+  }
+
+  struct Variant {
+    const char *name;
+    double time;
+  };
+  const Variant variants[] = {
+      {"old yoke rule",
+       nanosecondsPerSample(samples, rounds, LegacyYokeRule())},
+      {"old rudder rule",
+       nanosecondsPerSample(samples, rounds, LegacyRudderRule())},
+      {"filter off",
+       nanosecondsPerSample(samples, rounds, makeFilter(1, 0, 0, 0))},
+      {"median 3",
+       nanosecondsPerSample(samples, rounds, makeFilter(3, 0, 0, 0))},
+      {"median 5",
+       nanosecondsPerSample(samples, rounds, makeFilter(5, 0, 0, 0))},
+      {"smoothing 50",
+       nanosecondsPerSample(samples, rounds, makeFilter(1, 50, 0, 0))},
+      {"deadband 4",
+       nanosecondsPerSample(samples, rounds, makeFilter(1, 0, 4, 0))},
+      {"slew 50",
+       nanosecondsPerSample(samples, rounds, makeFilter(1, 0, 0, 50))},
+      {"all stages",
+       nanosecondsPerSample(samples, rounds, makeFilter(3, 50, 4, 200))},
+  };
+  for (const auto &variant : variants) {
+    std::printf("%-20s %8.2f ns/sample\n", variant.name, variant.time);
+  }
+  std::printf("checksum %lld\n", checksum);
+  return 0;
+}
@@ -0,0 +1,6 @@
+// The serial benchmarks run without Qt, so ports keep the wait time and
+// baud rate they were constructed with instead of reading the settings
+
+#include <headers/SerialPort.hpp>
+
+void SerialPort::loadSettings() {}
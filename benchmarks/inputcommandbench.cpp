@@ -0,0 +1,111 @@
+// Splits board messages the way the handlers did before parseInputCommand,
+// stoi on the first four characters for the prefix and strtok with strtod
+// over a copy of the line for the values, and with parseInputCommand.
+
+#include <Inputs/inputcommand.h>
+#include <string.h>
+
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <string>
+#include <vector>
+
+namespace {
+
+// What the handler does with the values, kept cheap and impossible to
+// optimize away
+long long checksum = 0;
+
+// strtok_s on Windows, strtok_r elsewhere
+char *nextToken(char *string, char **context) {
+#ifdef _WIN32
+  return strtok_s(string, " ", context);
+#else
+  return strtok_r(string, " ", context);
+#endif
+}
+
+void parseLegacy(const std::string &line) {
+  try {
+    checksum += std::stoi(line.substr(0, 4));
+    char receivedString[64];
+    const size_t length = line.copy(receivedString, sizeof receivedString - 1);
+    receivedString[length] = '\0';
+
+    char *context = nullptr;
+    char *token = nextToken(receivedString, &context);
+    int counter = 0;
+    while (token != nullptr) {
+      if (counter != 0) {
+        checksum += static_cast<int>(strtod(token, nullptr));
+      }
+      counter++;
+      token = nextToken(nullptr, &context);
+    }
+  } catch (const std::exception &e) {
+    checksum--;
+  }
+}
+
+void parseCurrent(const std::string &line) {
+  const InputCommand command = parseInputCommand(line);
+  if (!command.isValid()) {
+    checksum--;
+    return;
+  }
+  checksum += command.prefix;
+  for (int i = 0; i < command.fieldCount; i++) {
+    checksum += command.fields[i];
+  }
+}
+
+template <typename Parse>
+double nanosecondsPerLine(const std::vector<std::string> &lines, int rounds,
+                          Parse parse) {
+  const auto start = std::chrono::steady_clock::now();
+  for (int round = 0; round < rounds; round++) {
+    for (const auto &line : lines) {
+      parse(line);
+    }
+  }
+  const std::chrono::duration<double, std::nano> elapsed =
+      std::chrono::steady_clock::now() - start;
+  return elapsed.count() / (static_cast<double>(lines.size()) * rounds);
+}
+
+}  // namespace
+
+int main(int argc, char **argv) {
+  const int rounds = argc > 1 ? std::atoi(argv[1]) : 2000;
+
+  // Axis messages with several values, encoder and switch messages without
+  // and the occasional decimal value
+  const std::vector<std::string> mix = {
+      "199 512 512 600 600", "103 400 600", "901 512", "115 700",
+      "902 12 1000",         "322 ",        "371 ",    "401 ",
+      "1500 1",              "198 511.75 512.25"};
+  std::vector<std::string> lines;
+  for (int i = 0; i < 1000; i++) {
+    lines.push_back(mix[(i * 7) % mix.size()]);
+  }
+
+  // Both have to read the same values out of the mix
+  checksum = 0;
+  nanosecondsPerLine(lines, 1, parseLegacy);
+  const long long legacySum = checksum;
+  checksum = 0;
+  nanosecondsPerLine(lines, 1, parseCurrent);
+  if (checksum != legacySum) {
+    std::printf("the parsers disagree on the mix\n");
+    return 1;
+  }
+
+  const double legacyTime = nanosecondsPerLine(lines, rounds, parseLegacy);
+  const double currentTime = nanosecondsPerLine(lines, rounds, parseCurrent);
+  std::printf("%-24s %8.1f ns/line\n", "strtok + stoi/strtod", legacyTime);
+  std::printf("%-24s %8.1f ns/line\n", "parseInputCommand", currentTime);
+  std::printf("speedup %.1fx (checksum %lld)\n", legacyTime / currentTime,
+              checksum);
+  return 0;
+}
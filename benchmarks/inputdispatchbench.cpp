@@ -0,0 +1,115 @@
+// Dispatches a mix of board messages the way switchHandling did before the
+// dispatch table, a string prefix, stoi and a switch with a case per prefix,
+// and with parseInputCommand and inputdispatch::lookup. Reports the time per
+// message for the whole step and for the prefix to handler step alone.
+
+#include <Inputs/inputcommand.h>
+#include <Inputs/inputdispatchtable.h>
+#include <Inputs/inputenum.h>
+
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <string>
+#include <vector>
+
+namespace inputdispatch {
+namespace {
+
+Entry legacyEntry(int prefix) {
+  switch (prefix) {
+#include "legacyinputswitch.inc"
+    default:
+      return {WASM, 0, 0};
+  }
+}
+
+}  // namespace
+}  // namespace inputdispatch
+
+namespace {
+
+// What the handler does with the entry, kept cheap and impossible to
+// optimize away
+size_t checksum = 0;
+void sink(const inputdispatch::Entry &entry, int value) {
+  checksum += entry.kind + entry.event + entry.value + value;
+}
+
+// The prefix is the first four characters, the line length check stands in
+// for the board never sending less than that
+void dispatchLegacy(const std::string &line) {
+  const int prefix = std::stoi(line.substr(0, 4));
+  const int value = line.size() > 4 ? std::stoi(line.substr(4)) : 0;
+  sink(inputdispatch::legacyEntry(prefix), value);
+}
+
+void dispatchTable(const std::string &line) {
+  const InputCommand command = parseInputCommand(line);
+  if (!command.isValid()) {
+    return;
+  }
+  sink(inputdispatch::lookup(command.prefix),
+       command.fieldCount > 0 ? command.fields[0] : 0);
+}
+
+template <typename Step, typename Item>
+double nanosecondsPer(const std::vector<Item> &items, int rounds, Step step) {
+  const auto start = std::chrono::steady_clock::now();
+  for (int round = 0; round < rounds; round++) {
+    for (const auto &item : items) {
+      step(item);
+    }
+  }
+  const std::chrono::duration<double, std::nano> elapsed =
+      std::chrono::steady_clock::now() - start;
+  return elapsed.count() / (static_cast<double>(items.size()) * rounds);
+}
+
+}  // namespace
+
+int main(int argc, char **argv) {
+  const int rounds = argc > 1 ? std::atoi(argv[1]) : 2000;
+
+  // A panel being flown: mostly encoder detents and axis updates, some
+  // switches and a few events that go to the WASM module
+  const std::vector<std::string> mix = {
+      "322 ", "323 ", "371 ", "372 ", "154 ", "155 ",
+      "199 512 512 600 600", "103 400 600", "901 512", "115 700",
+      "401 ", "402 ", "116 ", "908 ", "1500 1", "2001 0"};
+  std::vector<std::string> lines;
+  for (int i = 0; i < 1000; i++) {
+    lines.push_back(mix[(i * 7) % mix.size()]);
+  }
+  std::vector<int> prefixes;
+  for (const auto &line : lines) {
+    prefixes.push_back(parseInputCommand(line).prefix);
+  }
+
+  for (const int prefix : prefixes) {
+    const inputdispatch::Entry legacy = inputdispatch::legacyEntry(prefix);
+    const inputdispatch::Entry &current = inputdispatch::lookup(prefix);
+    if (legacy.kind != current.kind || legacy.event != current.event ||
+        legacy.value != current.value) {
+      std::printf("prefix %d dispatches differently\n", prefix);
+      return 1;
+    }
+  }
+
+  const double legacyLine = nanosecondsPer(lines, rounds, dispatchLegacy);
+  const double tableLine = nanosecondsPer(lines, rounds, dispatchTable);
+  const double legacyPrefix = nanosecondsPer(prefixes, rounds, [](int p) {
+    sink(inputdispatch::legacyEntry(p), 0);
+  });
+  const double tablePrefix = nanosecondsPer(
+      prefixes, rounds, [](int p) { sink(inputdispatch::lookup(p), 0); });
+
+  std::printf("%-28s %8.1f ns/message\n", "stoi + switch", legacyLine);
+  std::printf("%-28s %8.1f ns/message\n", "parseInputCommand + table",
+              tableLine);
+  std::printf("%-28s %8.2f ns/prefix\n", "switch only", legacyPrefix);
+  std::printf("%-28s %8.2f ns/prefix\n", "table only", tablePrefix);
+  std::printf("speedup %.1fx per message (checksum %zu)\n",
+              legacyLine / tableLine, checksum);
+  return 0;
+}
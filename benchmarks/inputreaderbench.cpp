@@ -0,0 +1,170 @@
+// Sixteen pty boards, one of them chatty, read the way InputWorker did
+// before the input readers (one thread waits on every port, then reads and
+// handles them in turn) and with InputReaders feeding an InputQueue that a
+// single consumer drains. Every record costs the consumer the time of a
+// SimConnect call. Reports how old the lines of the quiet boards and of the
+// chatty board are when they are handled.
+
+#include <Inputs/inputcommand.h>
+#include <Inputs/inputqueue.h>
+#include <Inputs/inputreader.h>
+#include <headers/SerialPort.hpp>
+#include <headers/constants.h>
+
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <memory>
+#include <string_view>
+#include <thread>
+#include <vector>
+
+#include "ptyboards.h"
+
+namespace {
+
+constexpr int quietPrefix = 1500;
+constexpr int chattyPrefix = 1501;
+
+struct Options {
+  int boards = 16;
+  int seconds = 3;
+  int transmitUs = 20;
+};
+
+struct Samples {
+  std::vector<uint64_t> quiet;
+  std::vector<uint64_t> chatty;
+  size_t maxDepth = 0;
+
+  void record(const InputCommand &command, int transmitUs) {
+    simulateTransmit(transmitUs);
+    if (command.fieldCount < 1) {
+      return;
+    }
+    const uint64_t age = (stampUs() - command.fields[0]) * uint64_t{1000};
+    (command.prefix == chattyPrefix ? chatty : quiet).push_back(age);
+  }
+};
+
+// One thread for every board, the first one sends bursts of 40 lines every
+// 10 ms and the others a line every 10 ms
+class Fleet {
+ public:
+  explicit Fleet(int count) {
+    for (int i = 0; i < count; i++) {
+      boards.push_back(std::make_unique<PtyBoard>());
+      ports.push_back(std::make_unique<SerialPort>(boards.back()->portName()));
+      if (!ports.back()->isConnected()) {
+        std::printf("could not open %s\n", boards.back()->portName());
+        std::exit(1);
+      }
+      portList.push_back(ports.back().get());
+    }
+  }
+
+  void start() {
+    for (size_t i = 0; i < boards.size(); i++) {
+      senders.emplace_back(sendStamped, boards[i].get(),
+                           i == 0 ? chattyPrefix : quietPrefix, 10000,
+                           i == 0 ? 40 : 1, &stop);
+    }
+  }
+
+  void finish() {
+    stop = true;
+    for (auto &sender : senders) {
+      sender.join();
+    }
+  }
+
+  std::vector<SerialPort *> portList;
+
+ private:
+  std::vector<std::unique_ptr<PtyBoard>> boards;
+  std::vector<std::unique_ptr<SerialPort>> ports;
+  std::vector<std::thread> senders;
+  std::atomic<bool> stop{false};
+};
+
+Samples runSequential(const Options &options) {
+  Fleet fleet(options.boards);
+  Samples samples;
+  const auto deadline =
+      std::chrono::steady_clock::now() + std::chrono::seconds(options.seconds);
+  fleet.start();
+  std::string_view line;
+  while (std::chrono::steady_clock::now() < deadline) {
+    SerialPort::waitForData(fleet.portList.data(), fleet.portList.size(),
+                            constants::serialWaitTimeoutMs);
+    for (SerialPort *port : fleet.portList) {
+      if (port->fillLineFramer() <= 0) {
+        continue;
+      }
+      while (port->readLine(&line)) {
+        const InputCommand command = parseInputCommand(line);
+        if (command.isValid()) {
+          samples.record(command, options.transmitUs);
+        }
+      }
+    }
+  }
+  fleet.finish();
+  return samples;
+}
+
+Samples runReaders(const Options &options) {
+  Fleet fleet(options.boards);
+  Samples samples;
+  InputQueue queue;
+  InputReaders readers(&queue);
+  const auto deadline =
+      std::chrono::steady_clock::now() + std::chrono::seconds(options.seconds);
+  readers.start(fleet.portList);
+  fleet.start();
+  InputRecord record;
+  while (std::chrono::steady_clock::now() < deadline) {
+    queue.waitForRecords(constants::serialWaitTimeoutMs);
+    samples.maxDepth = std::max(samples.maxDepth, queue.depth());
+    while (queue.pop(&record)) {
+      samples.record(record.command, options.transmitUs);
+    }
+  }
+  fleet.finish();
+  readers.stop();
+  if (queue.droppedRecords() > 0) {
+    std::printf("the queue dropped %llu records\n",
+                static_cast<unsigned long long>(queue.droppedRecords()));
+  }
+  return samples;
+}
+
+void print(const char *name, const Samples &samples, int seconds) {
+  std::printf("%s: %.0f records/s", name,
+              (samples.quiet.size() + samples.chatty.size()) /
+                  static_cast<double>(seconds));
+  if (samples.maxDepth > 0) {
+    std::printf(", queue depth up to %zu", samples.maxDepth);
+  }
+  std::printf("\n");
+  printLatencies("  quiet boards", samples.quiet);
+  printLatencies("  chatty board", samples.chatty);
+}
+
+}  // namespace
+
+int main(int argc, char **argv) {
+  Options options;
+  if (argc > 1) {
+    options.boards = std::max(2, std::atoi(argv[1]));
+  }
+  if (argc > 2) {
+    options.transmitUs = std::atoi(argv[2]);
+  }
+  stampUs();
+
+  print("one thread, ports in turn", runSequential(options), options.seconds);
+  print("InputReaders + InputQueue", runReaders(options), options.seconds);
+  return 0;
+}
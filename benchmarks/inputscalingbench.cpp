@@ -0,0 +1,104 @@
+// Runs InputReaders and an InputQueue with 1 to 64 pty boards, each sending
+// a line every 5 ms, and reports the CPU time the readers and the consumer
+// spend per message and how old the messages are when they are handled.
+// Per message cost should stay flat as boards are added.
+
+#include <Inputs/inputqueue.h>
+#include <Inputs/inputreader.h>
+#include <headers/SerialPort.hpp>
+#include <headers/constants.h>
+#include <time.h>
+
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <memory>
+#include <thread>
+#include <vector>
+
+#include "ptyboards.h"
+
+namespace {
+
+constexpr int periodUs = 5000;
+
+double cpuSeconds(clockid_t clock) {
+  timespec now;
+  clock_gettime(clock, &now);
+  return now.tv_sec + now.tv_nsec / 1e9;
+}
+
+// A single thread plays every board so its own CPU time can be taken out
+// of the process total
+void sendAll(const std::vector<std::unique_ptr<PtyBoard>> *boards,
+             const std::atomic<bool> *stop, double *cpu) {
+  char line[32];
+  auto next = std::chrono::steady_clock::now();
+  while (!stop->load()) {
+    for (const auto &board : *boards) {
+      const int length =
+          std::snprintf(line, sizeof line, "1500 %d\n", stampUs());
+      board->send(line, length);
+    }
+    next += std::chrono::microseconds(periodUs);
+    std::this_thread::sleep_until(next);
+  }
+  *cpu = cpuSeconds(CLOCK_THREAD_CPUTIME_ID);
+}
+
+void measure(int count, int seconds) {
+  std::vector<std::unique_ptr<PtyBoard>> boards;
+  std::vector<std::unique_ptr<SerialPort>> ports;
+  std::vector<SerialPort *> portList;
+  for (int i = 0; i < count; i++) {
+    boards.push_back(std::make_unique<PtyBoard>());
+    ports.push_back(std::make_unique<SerialPort>(boards.back()->portName()));
+    portList.push_back(ports.back().get());
+  }
+
+  InputQueue queue;
+  InputReaders readers(&queue);
+  std::atomic<bool> stop{false};
+  double senderCpu = 0;
+  std::vector<uint64_t> latencies;
+
+  const double processBefore = cpuSeconds(CLOCK_PROCESS_CPUTIME_ID);
+  readers.start(portList);
+  std::thread sender(sendAll, &boards, &stop, &senderCpu);
+  const auto deadline =
+      std::chrono::steady_clock::now() + std::chrono::seconds(seconds);
+  InputRecord record;
+  while (std::chrono::steady_clock::now() < deadline) {
+    queue.waitForRecords(constants::serialWaitTimeoutMs);
+    while (queue.pop(&record)) {
+      if (record.command.fieldCount > 0) {
+        latencies.push_back((stampUs() - record.command.fields[0]) *
+                            uint64_t{1000});
+      }
+    }
+  }
+  stop = true;
+  sender.join();
+  readers.stop();
+  const double cpu =
+      cpuSeconds(CLOCK_PROCESS_CPUTIME_ID) - processBefore - senderCpu;
+
+  char name[32];
+  std::snprintf(name, sizeof name, "%2d boards", count);
+  std::printf("%s: %7zu messages, %6.2f us CPU/message\n", name,
+              latencies.size(),
+              latencies.empty() ? 0.0 : cpu * 1e6 / latencies.size());
+  printLatencies("", latencies);
+}
+
+}  // namespace
+
+int main(int argc, char **argv) {
+  const int seconds = argc > 1 ? std::atoi(argv[1]) : 2;
+  stampUs();
+  for (const int count : {1, 2, 4, 8, 16, 32, 64}) {
+    measure(count, seconds);
+  }
+  return 0;
+}
@@ -0,0 +1,149 @@
+// Formats output lines the old way and with OutputLineFormatter and reports
+// the throughput and the heap allocations of both. The serial write is left
+// out, both variants hand their line to the same sink.
+
+#include <outputs/outputlineformatter.h>
+
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <new>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace {
+
+size_t allocations = 0;
+
+struct Datum {
+  int prefix;
+  float value;
+  int mode;
+};
+
+// What the worker does with the line, kept cheap and impossible to optimize
+// away
+size_t checksum = 0;
+void sink(const char *line, size_t length) {
+  checksum += length + static_cast<unsigned char>(line[length - 1]);
+}
+
+// sendToArduino before OutputLineFormatter, without the console output
+size_t formatLegacy(float received, const std::string &prefix, int mode) {
+  int intVal;
+  std::string prefixString = prefix;
+  if (stoi(prefix) < 1000) {
+    prefixString += " ";
+  }
+  std::string input_string;
+
+  if (mode != 4) {
+    intVal = static_cast<int>(received);
+  } else {
+    intVal = received == 0 ? 0 : 1;
+    input_string = prefixString + std::to_string(intVal);
+  }
+
+  if (mode == 3) {
+    input_string = prefixString + std::to_string(received);
+  } else {
+    input_string = prefixString + std::to_string(intVal);
+  }
+
+  auto *const c_string = new char[input_string.size() + 1];
+  std::copy(input_string.begin(), input_string.end(), c_string);
+  c_string[input_string.size()] = '\n';
+  unsigned int length = input_string.size() + 1;
+  sink(c_string, length);
+  delete[] c_string;
+  return length;
+}
+
+struct Result {
+  double bytesPerSecond;
+  double allocationsPerLine;
+};
+
+template <typename Format>
+Result run(const std::vector<Datum> &data, int rounds, Format format) {
+  size_t bytes = 0;
+  const size_t allocationsBefore = allocations;
+  const auto start = std::chrono::steady_clock::now();
+  for (int round = 0; round < rounds; round++) {
+    for (const auto &datum : data) {
+      bytes += format(datum);
+    }
+  }
+  const std::chrono::duration<double> elapsed =
+      std::chrono::steady_clock::now() - start;
+  return {bytes / elapsed.count(),
+          static_cast<double>(allocations - allocationsBefore) /
+              (static_cast<double>(data.size()) * rounds)};
+}
+
+}  // namespace
+
+void *operator new(size_t size) {
+  allocations++;
+  if (void *memory = std::malloc(size)) {
+    return memory;
+  }
+  throw std::bad_alloc();
+}
+
+void operator delete(void *memory) noexcept { std::free(memory); }
+void operator delete(void *memory, size_t) noexcept { std::free(memory); }
+
+int main(int argc, char **argv) {
+  const int rounds = argc > 1 ? std::atoi(argv[1]) : 2000;
+
+  // A mix like a typical set: mostly integers, some decimals and booleans
+  std::vector<Datum> data;
+  for (int i = 0; i < 1000; i++) {
+    const int prefix = i % 3 == 0 ? 1000 + i : 200 + i % 700;
+    const float value = static_cast<float>(i) * 13.37f - 2000.0f;
+    const int mode = i % 10 == 0 ? 3 : (i % 10 == 1 ? 4 : 0);
+    data.push_back({prefix, value, mode});
+  }
+
+  std::vector<std::string> prefixes;
+  std::vector<std::string> wirePrefixes;
+  for (const auto &datum : data) {
+    prefixes.push_back(std::to_string(datum.prefix));
+    wirePrefixes.push_back(OutputLineFormatter::wirePrefix(datum.prefix));
+  }
+
+  size_t index = 0;
+  const Result legacy = run(data, rounds, [&](const Datum &datum) {
+    const size_t length =
+        formatLegacy(datum.value, prefixes[index], datum.mode);
+    index = (index + 1) % data.size();
+    return length;
+  });
+
+  char buffer[OutputLineFormatter::maxLineLength];
+  index = 0;
+  const Result current = run(data, rounds, [&](const Datum &datum) {
+    auto valueFormat = OutputLineFormatter::INTEGER;
+    if (datum.mode == 3) {
+      valueFormat = OutputLineFormatter::DECIMAL;
+    } else if (datum.mode == 4) {
+      valueFormat = OutputLineFormatter::BOOLEAN;
+    }
+    const auto line = OutputLineFormatter::format(buffer, wirePrefixes[index],
+                                                  datum.value, valueFormat);
+    sink(line.data(), line.size());
+    index = (index + 1) % data.size();
+    return line.size();
+  });
+
+  std::printf("%-20s %10.1f MB/s %6.2f allocations/line\n", "legacy",
+              legacy.bytesPerSecond / 1e6, legacy.allocationsPerLine);
+  std::printf("%-20s %10.1f MB/s %6.2f allocations/line\n",
+              "OutputLineFormatter", current.bytesPerSecond / 1e6,
+              current.allocationsPerLine);
+  std::printf("speedup %.1fx (checksum %zu)\n",
+              current.bytesPerSecond / legacy.bytesPerSecond, checksum);
+  return 0;
+}
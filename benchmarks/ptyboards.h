@@ -0,0 +1,113 @@
+#ifndef PTYBOARDS_H
+#define PTYBOARDS_H
+
+// Pseudo terminals standing in for boards in the serial benchmarks. The
+// SerialPort under test opens the slave side like a real device, the
+// benchmark writes the board's messages into the master side.
+
+#include <fcntl.h>
+#include <poll.h>
+#include <stdlib.h>
+#include <unistd.h>
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <string>
+#include <thread>
+#include <vector>
+
+class PtyBoard {
+ public:
+  PtyBoard() {
+    master = posix_openpt(O_RDWR | O_NOCTTY | O_CLOEXEC);
+    if (master < 0 || grantpt(master) != 0 || unlockpt(master) != 0) {
+      std::perror("posix_openpt");
+      std::exit(1);
+    }
+    slaveName = ptsname(master);
+  }
+  ~PtyBoard() { close(master); }
+  PtyBoard(const PtyBoard &) = delete;
+  PtyBoard &operator=(const PtyBoard &) = delete;
+
+  const char *portName() const { return slaveName.c_str(); }
+
+  // Writes the whole line, waiting while the pty's buffer is full
+  void send(const char *line, size_t length) {
+    size_t sent = 0;
+    while (sent < length) {
+      const ssize_t written = write(master, line + sent, length - sent);
+      if (written > 0) {
+        sent += written;
+        continue;
+      }
+      pollfd ready = {master, POLLOUT, 0};
+      poll(&ready, 1, 10);
+    }
+  }
+
+ private:
+  int master;
+  std::string slaveName;
+};
+
+inline uint64_t nowNs() {
+  return std::chrono::duration_cast<std::chrono::nanoseconds>(
+             std::chrono::steady_clock::now().time_since_epoch())
+      .count();
+}
+
+// Microseconds since the first call, small enough to travel as a field of
+// a message
+inline int stampUs() {
+  static const auto start = std::chrono::steady_clock::now();
+  return static_cast<int>(std::chrono::duration_cast<std::chrono::microseconds>(
+                              std::chrono::steady_clock::now() - start)
+                              .count());
+}
+
+// Plays a board until stop is set: every periodUs it sends burst lines of
+// "<prefix> <stampUs()>", so the receiver can tell how old each line is
+inline void sendStamped(PtyBoard *board, int prefix, int periodUs, int burst,
+                        const std::atomic<bool> *stop) {
+  char line[32];
+  auto next = std::chrono::steady_clock::now();
+  while (!stop->load()) {
+    for (int i = 0; i < burst; i++) {
+      const int length =
+          std::snprintf(line, sizeof line, "%d %d\n", prefix, stampUs());
+      board->send(line, length);
+    }
+    next += std::chrono::microseconds(periodUs);
+    std::this_thread::sleep_until(next);
+  }
+}
+
+// Burns the time a SimConnect call takes, so the consumer has work per
+// record like it has in the connector
+inline void simulateTransmit(int microseconds) {
+  const auto until = std::chrono::steady_clock::now() +
+                     std::chrono::microseconds(microseconds);
+  while (std::chrono::steady_clock::now() < until) {
+  }
+}
+
+// Prints the percentiles of a set of latencies given in nanoseconds
+inline void printLatencies(const char *name, std::vector<uint64_t> samples) {
+  if (samples.empty()) {
+    std::printf("%-24s no samples\n", name);
+    return;
+  }
+  std::sort(samples.begin(), samples.end());
+  const auto at = [&](double fraction) {
+    const size_t index = static_cast<size_t>(fraction * (samples.size() - 1));
+    return samples[index] / 1e3;
+  };
+  std::printf("%-24s p50 %9.1f us  p90 %9.1f us  p99 %9.1f us  max %9.1f us\n",
+              name, at(0.5), at(0.9), at(0.99), at(1.0));
+}
+
+#endif  // PTYBOARDS_H
@@ -0,0 +1,93 @@
+// Measures how long a line a board sends takes to reach the input handler,
+// with the loop the input worker had before SerialPort::waitForData, which
+// slept 10 ms per pass and 10 ms in switchHandling per message, and with the
+// loop the input readers run now. The board is a pty that sends at random
+// intervals, so the samples cover every phase of the old sleep.
+
+#include <Inputs/inputcommand.h>
+#include <headers/SerialPort.hpp>
+#include <headers/constants.h>
+
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <random>
+#include <string_view>
+#include <thread>
+#include <vector>
+
+#include "ptyboards.h"
+
+namespace {
+
+struct Run {
+  explicit Run(int messages) : sentAt(messages) {}
+
+  // Written before the line goes out, read once it arrived
+  std::vector<std::atomic<uint64_t>> sentAt;
+  std::vector<uint64_t> latencies;
+  std::atomic<bool> done{false};
+};
+
+// Runs until every line arrived, the sender stamps each line with its index
+void receive(SerialPort *port, Run *run, bool sleeping) {
+  std::string_view line;
+  const auto deadline = std::chrono::steady_clock::now() +
+                        std::chrono::milliseconds(run->sentAt.size() * 60);
+  while (run->latencies.size() < run->sentAt.size() &&
+         std::chrono::steady_clock::now() < deadline) {
+    if (!sleeping) {
+      SerialPort::waitForData(&port, 1, constants::serialWaitTimeoutMs);
+    }
+    port->fillLineFramer();
+    while (port->readLine(&line)) {
+      const InputCommand command = parseInputCommand(line);
+      if (command.isValid() && command.fieldCount == 1) {
+        const uint64_t sentAt = run->sentAt[command.fields[0]].load();
+        run->latencies.push_back(nowNs() - sentAt);
+      }
+      if (sleeping) {
+        std::this_thread::sleep_for(std::chrono::milliseconds(10));
+      }
+    }
+    if (sleeping) {
+      std::this_thread::sleep_for(std::chrono::milliseconds(10));
+    }
+  }
+  run->done = true;
+}
+
+std::vector<uint64_t> measure(int messages, bool sleeping) {
+  PtyBoard board;
+  SerialPort port(board.portName());
+  if (!port.isConnected()) {
+    std::printf("could not open %s\n", board.portName());
+    std::exit(1);
+  }
+
+  Run run(messages);
+  std::thread reader(receive, &port, &run, sleeping);
+
+  std::mt19937 random(42);
+  std::uniform_int_distribution<int> gapUs(1000, 20000);
+  char buffer[32];
+  for (int i = 0; i < messages && !run.done; i++) {
+    std::this_thread::sleep_for(std::chrono::microseconds(gapUs(random)));
+    const int length = std::snprintf(buffer, sizeof buffer, "1500 %d\n", i);
+    run.sentAt[i] = nowNs();
+    board.send(buffer, length);
+  }
+  reader.join();
+  return run.latencies;
+}
+
+}  // namespace
+
+int main(int argc, char **argv) {
+  const int messages = argc > 1 ? std::atoi(argv[1]) : 200;
+
+  printLatencies("sleep 10 ms loop", measure(messages, true));
+  printLatencies("waitForData", measure(messages, false));
+  return 0;
+}
@@ -1,9 +1,13 @@
 #include "dualworker.h"
 
+#include <headers/SerialPortOpener.h>
+#include <headers/SimConnectHub.h>
+#include <headers/constants.h>
 #include <strsafe.h>
 #include <tchar.h>
 #include <windows.h>
 
+#include <chrono>
 #include <string>
 #include <utility>
 
@@ -11,7 +15,6 @@
 #define MAX_RETURNED_ITEMS 255
 
 using namespace std;
-SerialPort *dualPorts[10];
 
 // Attempt at WASM
 
@@ -21,7 +24,6 @@ struct StructOneDatum {
   int id;
   float value;
 };
-char receivedString[DATA_LENGTH];
 
 int radianDualToDegree(double rec) {
   double pi = 3.14159;
@@ -39,20 +41,23 @@ enum GROUP_ID { GROUP0 = 2, GROUP_A = 1 };
 enum INPUT_ID {
   INPUT0,
 };
+// Kept in the dual block of the shared SimConnect session
 enum EVENT_ID {
-  EVENT_SIM_START,
-  EVENT_WASM = 2,
-  EVENT_WASMINC = 3,
+  EVENT_SIM_START = SimConnectHub::dualIdBase,
+  EVENT_WASM = SimConnectHub::dualIdBase + 2,
+  EVENT_WASMINC = SimConnectHub::dualIdBase + 3,
 };
 struct dataStr {
   float val;
 };
 
+// DEFINITION_PDR_RADIO and REQUEST_PDR_RADIO are the first of one per rate
+// class
 enum DATA_DEFINE_ID {
-  DEFINITION_PDR_RADIO,
-  DEFINITION_STRING,
+  DEFINITION_PDR_RADIO = SimConnectHub::dualIdBase,
+  DEFINITION_STRING = DEFINITION_PDR_RADIO + OutputSchedule::rateClasses,
   DEFINITION_ELEVATOR_TRIM_PCT,
-  DEFINITION_1 = 12,
+  DEFINITION_1 = SimConnectHub::commandDefinitionID,
 
 };
 
@@ -71,9 +76,9 @@ struct StructDatum {
 };
 
 enum DATA_REQUEST_ID {
-  REQUEST_PDR_RADIO,
-  REQUEST_STRING,
-  REQUEST_1 = 10,
+  REQUEST_PDR_RADIO = SimConnectHub::dualIdBase,
+  REQUEST_STRING = REQUEST_PDR_RADIO + OutputSchedule::rateClasses,
+  REQUEST_1 = SimConnectHub::dualIdBase + 10,
 };
 
 void sendCommand(SIMCONNECT_CLIENT_EVENT_ID eventID) {
@@ -84,59 +89,18 @@ void sendCommand(SIMCONNECT_CLIENT_EVENT_ID eventID) {
 
 DualWorker::DualWorker() {}
 
-void sendDualToArduino(float received, std::string prefix, int index,
-                       int mode) {
-  int intVal;
-  std::string prefixString = prefix;
-  if (stoi(prefix) < 1000) {
-    prefixString += " ";
-  }
-  std::string input_string;
-  //  SimConnect_TransmitClientEvent(hSimConnect, objectID, EVENT_WASM, 2,
-  //                                 SIMCONNECT_GROUP_PRIORITY_HIGHEST,
-  //                                 SIMCONNECT_EVENT_FLAG_GROUPID_IS_PRIORITY);
-  if (mode != 99) {
-    cout << "0 checked" << endl;
-    cout << "VALUE = " << received << endl;
-    intVal = static_cast<int>(received);
-  } else {
-    if (received == 0) {
-      intVal = 0;
-    } else {
-      intVal = 1;
-    }
-    cout << "VALUE = " << std::fixed << received << endl;
-    input_string = prefixString + std::to_string(intVal);
-  }
-
+void sendDualToArduino(OutputWriters *writers, float received,
+                       const OutputRouter::Route &route, int index, int mode) {
+  auto valueFormat = OutputLineFormatter::INTEGER;
   if (mode == 3 || mode == 97) {
-    input_string = prefixString + std::to_string(received);
-    cout << "float " << input_string << endl;
-  } else {
-    const auto value = intVal;
-    input_string = prefixString + std::to_string(value);
-  }
-
-  cout << "size: " << input_string.size() << endl;
-  auto *const c_string = new char[input_string.size() + 1];
-  std::copy(input_string.begin(), input_string.end(), c_string);
-  c_string[input_string.size()] = '\n';
-  cout << strlen(c_string) << endl;
-  cout << input_string << endl;
-
-  if (mode == 1) {
-    if (received < 0) {
-      dualPorts[index]->writeSerialPort(c_string, 7);
-    } else {
-      dualPorts[index]->writeSerialPort(c_string, 6);
-    }
-  } else {
-    cout << "WHERE DOEST THIS COME FROM " << c_string << endl;
-    dualPorts[index]->writeSerialPort(c_string, input_string.size() + 1);
+    valueFormat = OutputLineFormatter::DECIMAL;
+  } else if (mode == 99) {
+    valueFormat = OutputLineFormatter::BOOLEAN;
   }
-  input_string.clear();
-
-  delete[] c_string;
+  // The board's writer sends it once the dispatch is done, unless a newer
+  // value replaced it by then
+  writers->store(index, route.wirePrefix, received, valueFormat,
+                 route.schedule);
 }
 void DualWorker::lastReceived(QString value) {
   emit updateLastValUI(std::move(value));
@@ -147,18 +111,23 @@ void DualWorker::MyDispatchProcInput(SIMCONNECT_RECV *pData, DWORD cbData,
   auto *dualCast = static_cast<DualWorker *>(pContext);
 
   switch (pData->dwID) {
+    case SIMCONNECT_RECV_ID_EVENT_FRAME: {
+      dualCast->dualInputHandler->axes.frameTick();
+      break;
+    }
     case SIMCONNECT_RECV_ID_EVENT: {
       auto *evt = (SIMCONNECT_RECV_EVENT *)pData;
       cout << "EVENT ID" << evt->uEventID;
       switch (evt->uEventID) {
         case EVENT_SIM_START: {
-          // Now the sim is running, request information on the user aircraft
-          SimConnect_RequestDataOnSimObject(
-              dualSimConnect, REQUEST_PDR_RADIO, DEFINITION_PDR_RADIO,
-              SIMCONNECT_OBJECT_ID_USER, SIMCONNECT_PERIOD_VISUAL_FRAME,
-              SIMCONNECT_DATA_REQUEST_FLAG_CHANGED |
-                  SIMCONNECT_DATA_REQUEST_FLAG_TAGGED,
-              0, 3);
+          // Now the sim is running, request information on the user
+          // aircraft. Dispatched without the hub's lock, the request takes it.
+          auto session =
+              SimConnectHub::instance().lock(dualCast->hubSubscriber);
+          if (session.valid()) {
+            dualCast->dualOutputMapper->requestOutputs(session.handle(),
+                                                       REQUEST_PDR_RADIO);
+          }
           cout << "started" << endl;
 
           break;
@@ -174,124 +143,94 @@ void DualWorker::MyDispatchProcInput(SIMCONNECT_RECV *pData, DWORD cbData,
     }
     case SIMCONNECT_RECV_ID_CLIENT_DATA: {
       auto pObjData = (SIMCONNECT_RECV_CLIENT_DATA *)pData;
-      int bundle = 0;
-
-      Output *output =
-          dualCast->outputHandler.findOutputById(pObjData->dwRequestID);
-      for (int i = 0; i < dualCast->outputBundles->size(); i++) {
-        if (dualCast->outputBundles->at(i)->isOutputInBundle(output->getId())) {
-          qDebug() << "FOUND IN SET";
-          bundle = i;
-        }
-      }
+      // Outputs only the output mode mapped arrive here as well, they have
+      // no route and are dropped
+      const auto *route = dualCast->router.find(pObjData->dwRequestID);
       dataStr *data = (dataStr *)&pObjData->dwData;
-      cout << "STRUCT TEST" << data->val << endl;
-      qDebug() << "DATA: " << pObjData->dwData << "ID: " << pObjData->dwID
-               << pObjData->dwRequestID << pObjData->dwDefineID
-               << pObjData->dwObjectID;
-
-      if (pObjData->dwRequestID > 999 && pObjData->dwRequestID < 9999) {
-        sendDualToArduino(
-            data->val, std::to_string(pObjData->dwRequestID), bundle,
-            dualCast->outputHandler.findOutputById(pObjData->dwRequestID)
-                ->getType());
+
+      if (route != nullptr && pObjData->dwRequestID > 999 &&
+          pObjData->dwRequestID < 9999) {
+        for (int port : route->ports) {
+          sendDualToArduino(&dualCast->writers, data->val, *route, port,
+                            route->type);
+        }
       }
     } break;
     case SIMCONNECT_RECV_ID_SIMOBJECT_DATA: {
       cout << "hiyi" << endl;
       auto *pObjData = (SIMCONNECT_RECV_SIMOBJECT_DATA *)pData;
+      DWORD requestID = pObjData->dwRequestID;
+      // Every rate class has its own request, they all carry tagged outputs
+      if (requestID > REQUEST_PDR_RADIO &&
+          requestID < REQUEST_PDR_RADIO + OutputSchedule::rateClasses) {
+        requestID = REQUEST_PDR_RADIO;
+      }
 
-      switch (pObjData->dwRequestID) {
+      switch (requestID) {
+        case EncoderAggregator::requestID: {
+          dualCast->dualInputHandler->encoders.receiveValues(
+              pObjData, EncoderAggregator::Clock::now());
+          break;
+        }
         case REQUEST_PDR_RADIO: {
-          cout << "RADIO" << endl;
           int count = 0;
           auto pS = reinterpret_cast<StructDatum *>(&pObjData->dwData);
 
           while (count < (int)pObjData->dwDefineCount) {
-            string valString = std::to_string(pS->datum[count].value);
-            int id = pS->datum[count].id;
-            Output *output = dualCast->outputHandler.findOutputById(id);
-            int bundle = 0;
-
-            for (int i = 0; i < dualCast->outputBundles->size(); i++) {
-              if (dualCast->outputBundles->at(i)->isOutputInBundle(
-                      output->getId())) {
-                qDebug() << "FOUND IN SET " << i << " bundles"
-                         << dualCast->outputBundles->size();
-                bundle = i;
-              }
+            const auto *route = dualCast->router.find(pS->datum[count].id);
+            if (route == nullptr) {
+              ++count;
+              continue;
             }
 
-            //            while (bundle == NULL) {
-            //              if
-            //              (outputCast->outputBundles->at(counter)->isOutputInBundle(
-            //                      output->getId())) {
-            //                bundle = counter;
-            //              }
-            //              counter++;
-            //            }
-
-            qDebug() << "id" << id << "BUNDLE ID" << bundle;
-            int mode = output->getType();
-            string prefix = std::to_string(output->getPrefix());
-            qDebug() << "MODE" << mode << "PREFIX"
-                     << QString::fromStdString(prefix)
-                     << pS->datum[count].value;
-
-            switch (mode) {
-              case 0: {
-                qDebug() << "normal";
-                sendDualToArduino(pS->datum[count].value, prefix, bundle, 0);
+            // Converted once, then sent to every board that shows it
+            float value = pS->datum[count].value;
+            int mode = 0;
+            bool send = true;
+            switch (route->type) {
+              case 0:
                 break;
-              }
-              case 1: {
-                qDebug() << "YARRR";
-                sendDualToArduino(pS->datum[count].value * 100, prefix, bundle,
-                                  0);
+              case 1:
+                value *= 100;
                 break;
-              }
-              case 2: {
-                sendDualToArduino(radianDualToDegree(pS->datum[count].value),
-                                  prefix, bundle, 0);
-                break;
-              }
-              case 3: {
-                sendDualToArduino(pS->datum[count].value, prefix, bundle, 3);
+              case 2:
+                value = radianDualToDegree(value);
                 break;
-              }; break;
-              case 4: {
-                sendDualToArduino(pS->datum[count].value, prefix, bundle, 4);
+              case 3:
+              case 4:
+                mode = route->type;
                 break;
-              }
-              case 5:;
+              case 5:
+                send = false;
                 break;
               case 6: {
-                int inHg = pS->datum[count].value * 1000;
+                int inHg = value * 1000;
                 if (inHg % (inHg / 10) >= 5) {
                   inHg += 10;
                 }
-                sendDualToArduino(inHg / 10, prefix, bundle, 0);
+                value = inHg / 10;
                 break;
               }
-              case 7: {
-                sendDualToArduino(pS->datum[count].value * 1.94, prefix, bundle,
-                                  0);
+              case 7:
+                value *= 1.94;
                 break;
-              }
-
-              case 8: {
-                sendDualToArduino(pS->datum[count].value / 1000, prefix, bundle,
-                                  0);
+              case 8:
+                value /= 1000;
                 break;
-              }
-
               default:
                 printf("\nUnknown datum ID: %i", pS->datum[count].id);
+                send = false;
                 break;
             }
-            ++count;
-            dualCast->lastReceived(QString::fromStdString(prefix) + " " +
+            if (send) {
+              for (int port : route->ports) {
+                sendDualToArduino(&dualCast->writers, value, *route, port,
+                                  mode);
+              }
+            }
+            dualCast->lastReceived(QString::number(route->prefix) + " " +
                                    QString::number(pS->datum[count].value));
+            ++count;
           }
 
           break;
@@ -303,7 +242,8 @@ void DualWorker::MyDispatchProcInput(SIMCONNECT_RECV *pData, DWORD cbData,
       break;
     }
     case SIMCONNECT_RECV_ID_QUIT: {
-      // quit = 1;
+      // Ends the session, RadioEvents() waits for the sim to come back
+      static_cast<DualWorker *>(pContext)->connected = false;
       break;
     }
   }
@@ -322,7 +262,16 @@ void DualWorker::sendWASMCommand(char cmd) {
   //      connect, object, 2, index, SIMCONNECT_GROUP_PRIORITY_HIGHEST,
   //      SIMCONNECT_EVENT_FLAG_GROUPID_IS_PRIORITY);
 
-  SimConnect_SetClientData(dualSimConnect, 1, 12,
+  if (hubSubscriber < 0) {
+    return;
+  }
+  auto session = SimConnectHub::instance().lock(hubSubscriber);
+  if (!session.valid()) {
+    return;
+  }
+  SimConnect_SetClientData(session.handle(),
+                           SimConnectHub::sharedClientDataID,
+                           SimConnectHub::commandDefinitionID,
                            SIMCONNECT_CLIENT_DATA_SET_FLAG_DEFAULT, 0, 256,
                            &arrayTest);
 }
@@ -334,134 +283,166 @@ void DualWorker::RadioEvents() {
   HRESULT hr;
 
   keys = settingsHandler.retrieveKeys("runningDualComs");
-  int keySize = keys->size();
-  int successfullyConnected = 0;
-  for (int i = 0; i < keySize; i++) {
-    dualPorts[i] = new SerialPort(
-        settingsHandler.retrieveSetting("runningDualComs", keys->at(i))
+  std::vector<std::string> portNames;
+  for (const auto &key : *keys) {
+    portNames.push_back(
+        settingsHandler.retrieveSetting("runningDualComs", key)
             ->toString()
-            .toStdString()
-            .c_str());
-
-    if (dualPorts[i]->isConnected()) {
+            .toStdString());
+  }
+  closePorts();
+  dualPorts = openSerialPorts(portNames);
+  for (auto *port : dualPorts) {
+    if (port->isConnected()) {
       cout << "CONNECTED" << endl;
       emit(BoardConnectionMade(1, 3));
-      successfullyConnected++;
     } else {
       cout << "NOT CONNECTED" << endl;
     }
   }
-  if (successfullyConnected == keySize) {
+  if (handshakeSerialPorts(dualPorts)) {
     emit(BoardConnectionMade(2, 3));
   }
-
-  bool connected = false;
-
-  while (!abortDual && !connected) {
-    // timerStart = QTime::currentTime();
-    emit(GameConnectionMade(1, 3));
-    if (SUCCEEDED(SimConnect_Open(&dualSimConnect, "dualConnect", nullptr, 0,
-                                  nullptr, 0))) {
-      connected = true;
-      emit(GameConnectionMade(2, 3));
-
+  writers.start(dualPorts, constants::outputFlushMaxBytes);
+  router.build(*outputBundles);
+  reconnector.watch(dualPorts);
+
+  auto &hub = SimConnectHub::instance();
+  SimConnectHub::Routes routes;
+  routes.events = {SimConnectHub::block(SimConnectHub::dualIdBase),
+                   {InputEnum::EVENT_AXIS_FRAME, InputEnum::EVENT_AXIS_FRAME}};
+  routes.objectData = {
+      SimConnectHub::block(SimConnectHub::dualIdBase),
+      {EncoderAggregator::requestID, EncoderAggregator::requestID}};
+  routes.clientData = {{1000, 9999}};
+  hubSubscriber = hub.subscribe(MyDispatchProcInput, this, routes);
+
+  connected = false;
+  emit(GameConnectionMade(1, 3));
+  // Every pass is one session with the sim. The hub maps the events and the
+  // shared client data once per session, the worker only sets up its own.
+  while (hub.connect(hubSubscriber, abortDual, [this] { checkPorts(); })) {
+    {
+      auto session = hub.lock(hubSubscriber);
+      if (!session.valid()) {
+        continue;
+      }
+      dualSimConnect = session.handle();
       cout << "Connection made" << outputsToMap.size() << endl;
 
-      SimConnect_MapClientDataNameToID(dualSimConnect, "shared", ClientDataID);
-
-      SimConnect_CreateClientData(dualSimConnect, ClientDataID, 256,
-                                  SIMCONNECT_CLIENT_DATA_REQUEST_FLAG_CHANGED);
-
-      //      SimConnect_MapClientEventToSimEvent(dualSimConnect, EVENT_WASM,
-      //                                          "LVAR_ACCESS.EFIS");
-
-      //      SimConnect_AddClientEventToNotificationGroup(dualSimConnect,
-      //      GROUP_A,
-      //                                                   EVENT_WASM, true);
-
-      //      SimConnect_SetNotificationGroupPriority(
-      //          dualSimConnect, GROUP_A, SIMCONNECT_GROUP_PRIORITY_HIGHEST);
-
       SimConnect_SetClientData(dualSimConnect, ClientDataID, DEFINITION_1,
                                SIMCONNECT_CLIENT_DATA_SET_FLAG_DEFAULT, 0, 256,
                                &dataF);
-
-      SimConnect_AddToClientDataDefinition(
-          dualSimConnect, 12, SIMCONNECT_CLIENTDATAOFFSET_AUTO, 256, 0);
       dualInputHandler->connect = dualSimConnect;
       dualInputHandler->object = SIMCONNECT_OBJECT_ID_USER;
 
-      dualInputMapper.mapEvents(dualSimConnect);
-
-      SimConnect_MapClientDataNameToID(dualSimConnect, "wasm.responses", 2);
-
-      SimConnect_CreateClientData(dualSimConnect, 2, 4096,
-                                  SIMCONNECT_CREATE_CLIENT_DATA_FLAG_DEFAULT);
-
       SimConnect_AddToClientDataDefinition(dualSimConnect, 0, 0,
                                            sizeof(dualDataRecv), 0, 0);
 
-      SimConnect_RequestClientData(dualSimConnect, ClientDataID, REQUEST_1,
-                                   DEFINITION_1,
-                                   SIMCONNECT_CLIENT_DATA_PERIOD_SECOND,
-                                   SIMCONNECT_CLIENT_DATA_REQUEST_FLAG_DEFAULT);
-
-      //      for (auto &simVar : dualSimVars) {
-      //        SimConnect_AddToClientDataDefinition(
-      //            dualSimConnect, simVar.ID, simVar.Offset, sizeof(float), 0,
-      //            0);
-      //        SimConnect_RequestClientData(
-      //            dualSimConnect, 2, simVar.ID, simVar.ID,
-      //            SIMCONNECT_CLIENT_DATA_PERIOD_ON_SET,
-      //            SIMCONNECT_CLIENT_DATA_REQUEST_FLAG_CHANGED, 0, 0, 0);
-      //      }
-      sendWASMCommand('8');
-      dualOutputMapper->mapOutputs(outputsToMap, dualSimConnect);
+      SimConnect_RequestClientData(
+          dualSimConnect, ClientDataID, REQUEST_1, DEFINITION_1,
+          SIMCONNECT_CLIENT_DATA_PERIOD_SECOND,
+          SIMCONNECT_CLIENT_DATA_REQUEST_FLAG_DEFAULT);
+
+      dualOutputMapper->mapOutputs(outputsToMap, dualSimConnect,
+                                   DEFINITION_PDR_RADIO);
       SimConnect_SubscribeToSystemEvent(dualSimConnect, EVENT_SIM_START,
                                         "1sec");
+      dualInputHandler->resetInputs();
 
-      SimConnect_RequestDataOnSimObject(
-          dualSimConnect, REQUEST_PDR_RADIO, DEFINITION_PDR_RADIO,
-          SIMCONNECT_OBJECT_ID_USER, SIMCONNECT_PERIOD_VISUAL_FRAME,
-          SIMCONNECT_DATA_REQUEST_FLAG_CHANGED |
-              SIMCONNECT_DATA_REQUEST_FLAG_TAGGED,
-          0, 3);
-
-      while (!abortDual) {
-        SimConnect_CallDispatch(dualSimConnect, MyDispatchProcInput, this);
-
-        // timerCheck = QTime::currentTime();
-
-        for (int i = 0; i < keys->size(); i++) {
-          const auto hasRead = dualPorts[i]->readSerialPort(
-              dualInputHandler->receivedString[i], DATA_LENGTH);
+      dualOutputMapper->requestOutputs(dualSimConnect, REQUEST_PDR_RADIO);
+    }
+    emit(GameConnectionMade(2, 3));
+    sendWASMCommand('8');
+
+    connected = true;
+    const auto wakeHandles = hub.wakeHandles(hubSubscriber);
+    auto lastReport = std::chrono::steady_clock::now();
+    while (!abortDual && connected) {
+      // timerCheck = QTime::currentTime();
+
+      // Serial input and SimConnect messages both wake the loop right
+      // away, the timeout only covers pending axes and the board checks
+      SerialPort::waitForData(
+          dualPorts.data(), dualPorts.size(),
+          dualInputHandler->msUntilFlush(constants::portHealthCheckMs),
+          wakeHandles.data(), wakeHandles.size());
+      if (!hub.dispatch(hubSubscriber)) {
+        connected = false;
+      }
+      writers.flush();
+      {
+        auto session = hub.lock(hubSubscriber);
+        for (auto *port : dualPorts) {
+          const auto hasRead = port->fillLineFramer();
 
           if (hasRead) {
-            if (connected) {
-              dualInputHandler->switchHandling(i);
+            std::string_view line;
+            while (connected && session.valid() && port->readLine(&line)) {
+              dualInputHandler->switchHandling(line);
               // timerStart = QTime::currentTime();
             }
           }
         }
-        std::this_thread::sleep_for(std::chrono::milliseconds(10));
+        if (session.valid()) {
+          dualInputHandler->flushInputs();
+        }
+      }
+      checkPorts();
+
+      const auto now = std::chrono::steady_clock::now();
+      if (now - lastReport >=
+          std::chrono::milliseconds(constants::outputStatsIntervalMs)) {
+        writers.report(
+            std::chrono::duration<double>(now - lastReport).count());
+        lastReport = now;
       }
-      SimConnect_Close(dualSimConnect);
     }
-  }
-  for (int i = 0; i < keys->size(); i++) {
-    if (dualPorts[i]->isConnected()) {
-      dualPorts[i]->closeSerial();
+    connected = false;
+    if (!abortDual) {
+      emit(GameConnectionMade(1, 3));
     }
   }
+  hub.unsubscribe(hubSubscriber);
+  hubSubscriber = -1;
+  closePorts();
   quit();
 }
 
+void DualWorker::closePorts() {
+  writers.stop();
+  for (auto *port : dualPorts) {
+    if (port->isConnected()) {
+      port->closeSerial();
+    }
+    delete port;
+  }
+  dualPorts.clear();
+}
+
+// Reopens boards that were unplugged and sends them the latest values, the
+// other boards and the SimConnect session aren't touched
+void DualWorker::checkPorts() {
+  const auto &reconnected = reconnector.poll();
+  // A board's writer stays off the port until it was reopened, reading it
+  // stays on this thread
+  for (int index : reconnector.lost()) {
+    writers.suspend(index);
+  }
+  for (int index : reconnected) {
+    writers.resume(index);
+  }
+  if (reconnector.changed()) {
+    emit(BoardConnectionMade(reconnector.allConnected() ? 2 : 1, 3));
+  }
+}
+
 void DualWorker::clearBundles() { this->outputBundles->clear(); }
 
 DualWorker::~DualWorker() {
-  for (int i = 0; i < keys->size(); i++) {
-    if (dualPorts[i]->isConnected()) {
-      dualPorts[i]->closeSerial();
+  for (auto *port : dualPorts) {
+    if (port->isConnected()) {
+      port->closeSerial();
     }
   }
   abortDual = true;
@@ -3,9 +3,13 @@
 
 #include <Inputs/InputMapper.h>
 #include <Inputs/InputSwitchHandler.h>
+#include <headers/PortReconnector.h>
+#include <headers/SimConnectHub.h>
 #include <outputs/outputbundle.h>
 #include <outputs/outputhandler.h>
 #include <outputs/outputmapper.h>
+#include <outputs/outputrouter.h>
+#include <outputs/outputwriters.h>
 #include <qsettings.h>
 #include <qstandardpaths.h>
 #include <qthread.h>
@@ -20,6 +24,7 @@
 #include <future>
 #include <iostream>
 #include <string>
+#include <vector>
 
 #include "headers/SimConnect.h"
 #include "strsafe.h"
@@ -61,7 +66,17 @@ class DualWorker : public QThread {
   InputMapper radioMap = InputMapper();
   QList<Output *> outputsToMap;
   QStringList *keys = new QStringList();
+  // One entry per configured board, indexed like the output bundles
+  std::vector<SerialPort *> dualPorts;
+  PortReconnector reconnector;
+  OutputWriters writers;
+  OutputRouter router;
+  // Our ID with the SimConnectHub while RadioEvents() runs
+  int hubSubscriber = -1;
+  bool connected = false;
   void lastReceived(QString value);
+  void closePorts();
+  void checkPorts();
 
  public:
   void setOutputsToMap(QList<Output *> list) { this->outputsToMap = list; };
@@ -0,0 +1,55 @@
+#ifndef PORTRECONNECTOR_H
+#define PORTRECONNECTOR_H
+
+#include <headers/SerialPort.hpp>
+
+#include <chrono>
+#include <vector>
+
+// Keeps track of the health of a worker's boards and reopens the ones that
+// were unplugged, so a loose cable doesn't need a Stop/Start of the whole
+// worker. Every port has its own backoff and the ports that are fine are
+// never touched. Only the thread that uses the ports may call poll(), a
+// port is closed and opened again in place.
+class PortReconnector {
+ public:
+  using Clock = std::chrono::steady_clock;
+
+  // Starts watching the given table, every port that is connected now
+  // counts as healthy
+  void watch(const std::vector<SerialPort *> &ports);
+
+  // Checks the ports at most every portHealthCheckMs and reopens the ones
+  // whose retry is due. Returns the indices of the ports that are back and
+  // past their settle time since the last call, they are ready for a
+  // replay of the latest values.
+  const std::vector<int> &poll();
+
+  // The indices of the ports found unplugged in the last poll(), they are
+  // reopened on a later one at the earliest
+  const std::vector<int> &lost() const { return lostNow; }
+
+  // True when a port was lost or came back in the last poll()
+  bool changed() const { return stateChanged; }
+  bool allConnected() const { return lostPorts == 0; }
+
+ private:
+  enum PortState { HEALTHY, LOST, SETTLING };
+
+  struct WatchedPort {
+    SerialPort *port;
+    PortState state;
+    int backoffMs;
+    // Next reopen attempt while LOST, end of the settle time while SETTLING
+    Clock::time_point due;
+  };
+
+  std::vector<WatchedPort> watched;
+  std::vector<int> reconnected;
+  std::vector<int> lostNow;
+  Clock::time_point nextCheck;
+  int lostPorts = 0;
+  bool stateChanged = false;
+};
+
+#endif  // PORTRECONNECTOR_H
@@ -0,0 +1,37 @@
+#ifndef SERIALLINEFRAMER_H
+#define SERIALLINEFRAMER_H
+
+#include <cstddef>
+#include <string_view>
+
+// Splits the raw byte stream of a serial port into '\n' terminated lines.
+// Bytes are read straight into the framer's buffer and complete lines are
+// handed out as views into that buffer, partial lines are kept until the rest
+// arrives with a later read. A view stays valid until the next prepareWrite.
+class SerialLineFramer {
+ public:
+  static constexpr size_t bufferSize = 1024;
+
+  SerialLineFramer() = default;
+
+  char *prepareWrite(size_t *available);
+  void commitWrite(size_t written);
+  bool nextLine(std::string_view *line);
+  void reset();
+
+  size_t pendingBytes() const { return end - start; }
+  unsigned long droppedBytes() const { return dropped; }
+
+ private:
+  char buffer[bufferSize];
+  // [start, end) holds received bytes that are not handed out yet, the bytes
+  // in [start, scanned) are known not to contain a line ending
+  size_t start = 0;
+  size_t scanned = 0;
+  size_t end = 0;
+  // Set when a line didn't fit the buffer, the rest of it is skipped
+  bool discarding = false;
+  unsigned long dropped = 0;
+};
+
+#endif  // SERIALLINEFRAMER_H
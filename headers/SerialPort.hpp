@@ -9,26 +9,99 @@
 
 #define MAX_DATA_LENGTH 25
 
-#include <settings/settingshandler.h>
+#include <headers/SerialLineFramer.h>
+#ifdef _WIN32
 #include <windows.h>
+#endif
 
+#include <atomic>
 #include <iostream>
+#include <string>
+#include <string_view>
 
+// A serial connection to one board. The Win32 backend lives in
+// SerialPort.cpp, the termios backend for other platforms in
+// SerialPortPosix.cpp. Both open the port once with the configured baud
+// rate and read without blocking, waitForData is the only call that sleeps.
 class SerialPort {
+ public:
+#ifdef _WIN32
+  using NativeHandle = HANDLE;
+#else
+  using NativeHandle = int;
+#endif
+
  private:
-  HANDLE handler;
-  bool connected;
-  COMSTAT status;
-  DWORD errors;
-  SettingsHandler settingsHandler;
+  NativeHandle handler;
+  // Read by the output writers while the thread that owns the port updates
+  // it
+  std::atomic<bool> connected{false};
+  std::string portName;
   int arduinoWaitTime = 15;
+  int baudRate = 115200;
+  SerialLineFramer lineFramer;
+#ifdef _WIN32
+  // Only touched by pollConnection() and waitForData()
+  COMSTAT status = {};
+  DWORD errors = 0;
+  OVERLAPPED readOverlapped = {};
+  OVERLAPPED writeOverlapped = {};
+  OVERLAPPED waitOverlapped = {};
+  DWORD waitEventMask = 0;
+  bool waitPending = false;
+
+  HANDLE armReadWait();
+  void completeReadWait();
+#endif
+
+  // Reads the wait time and baud rate from the settings, kept in
+  // SerialPortSettings.cpp so the backends build without Qt
+  void loadSettings();
+  // Opens portName with the configured settings, shared by the constructor
+  // and reopen()
+  void openPort();
 
  public:
   explicit SerialPort(const char *portName);
   ~SerialPort();
 
-  int readSerialPort(const char *buffer, unsigned int buf_size);
+  // Reads what the port has received into buffer without waiting for more;
+  // returns the number of bytes read, 0 if nothing was available or on error
+  int readSerialPort(char *buffer, unsigned int buf_size);
   bool writeSerialPort(const char *buffer, unsigned int buf_size);
-  bool isConnected();
+  int fillLineFramer();
+  bool readLine(std::string_view *line) { return lineFramer.nextLine(line); }
+  // Drops whatever was received but not taken with readLine yet
+  void discardLines() { lineFramer.reset(); }
+  // Whether the port was fine when it was last used or checked, safe to
+  // call from any thread
+  bool isConnected() const { return connected.load(); }
+  // Asks the driver whether the port is still there and updates
+  // isConnected(). Only the thread that reads and reopens the port may call
+  // it, the output writers just read isConnected().
+  bool pollConnection();
   void closeSerial();
+  // Closes the port and opens the same device again, for boards that were
+  // unplugged and plugged back in; returns isConnected()
+  bool reopen();
+
+  // How long the board needs after the port opened before it listens, the
+  // constructor doesn't wait for it so ports can be opened side by side
+  int settleTimeMs() const { return arduinoWaitTime; }
+
+  // The configured baud rate (the CBR setting), the output writers pace
+  // themselves to it
+  int baud() const { return baudRate; }
+
+  // The OS handle (file descriptor on POSIX) for readiness polling
+  NativeHandle nativeHandle() const { return handler; }
+
+  // Blocks until any of the ports has received bytes, one of the wake
+  // handles is signalled or the timeout expires. Wake handles are events on
+  // Windows and readable descriptors elsewhere, resetting them is left to
+  // their owner.
+  static bool waitForData(SerialPort *const *ports, int count,
+                          unsigned long timeoutMs,
+                          const NativeHandle *wakeHandles = nullptr,
+                          int wakeCount = 0);
 };
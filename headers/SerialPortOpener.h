@@ -0,0 +1,24 @@
+#ifndef SERIALPORTOPENER_H
+#define SERIALPORTOPENER_H
+
+#include <headers/SerialPort.hpp>
+
+#include <string>
+#include <vector>
+
+// Opens all boards of a mode at the same time. Every port is opened on its
+// own thread and the boards, which reset when their port opens, then share
+// a single settle time instead of waiting one after another. The returned
+// table has an entry for every name, ports that failed to open report
+// isConnected() == false.
+std::vector<SerialPort *> openSerialPorts(
+    const std::vector<std::string> &portNames);
+
+// Optional check that the firmware on every connected board is running.
+// When a probe is set in the options the probe line is sent to every board
+// and each board has boardHandshakeTimeoutMs to answer with anything. What
+// a board answers stays queued in its line framer. Returns true when every
+// board is connected and answered, or when no probe is configured.
+bool handshakeSerialPorts(const std::vector<SerialPort *> &ports);
+
+#endif  // SERIALPORTOPENER_H
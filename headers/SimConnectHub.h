@@ -0,0 +1,167 @@
+#ifndef SIMCONNECTHUB_H
+#define SIMCONNECTHUB_H
+
+#include <headers/SerialPort.hpp>
+#include <headers/SimConnect.h>
+#include <headers/SimConnectReconnector.h>
+#include <windows.h>
+
+#include <array>
+#include <deque>
+#include <functional>
+#include <mutex>
+#include <unordered_set>
+#include <vector>
+
+// The one SimConnect session shared by the input, output and dual modes.
+// The hub opens it when the first mode needs it, does the setup every mode
+// used to repeat (the InputMapper events, the "shared" and
+// "wasm.responses" client data areas and the frame event) and closes it
+// when the last mode stops.
+//
+// Every mode subscribes with the ID ranges it owns. Whichever mode
+// dispatches pulls everything SimConnect has queued, each message goes to
+// the mailbox of the modes whose range it falls in and every mode runs its
+// own DispatchProc on its mailbox on its own thread. All calls on the
+// handle, incoming and outgoing, are serialized by the hub's lock. The
+// DispatchProcs run without it, one that calls SimConnect takes a Session
+// like any other code.
+//
+// Nothing is polled: SimConnect signals the session event when it has
+// messages queued and the hub signals a mode's own event when its mailbox
+// fills, a mode waits on both through wakeHandles().
+class SimConnectHub {
+ public:
+  // SimConnect IDs belong to the connection, so the modes keep theirs
+  // apart: InputEnum starts at 0, the output prefixes (1000 - 9999) name
+  // client data definitions and requests, and the output and dual modes
+  // have a block of their own above those. The shared block holds what the
+  // hub sets up for every mode.
+  static constexpr DWORD outputIdBase = 10000;
+  static constexpr DWORD dualIdBase = 11000;
+  static constexpr DWORD sharedIdBase = 12000;
+  static constexpr DWORD idBlockSize = 1000;
+  // The encoder values, defined once per session and requested by the
+  // input and dual modes alike
+  static constexpr SIMCONNECT_DATA_DEFINITION_ID encoderDefinitionID =
+      sharedIdBase;
+  static constexpr SIMCONNECT_DATA_REQUEST_ID encoderRequestID = sharedIdBase;
+  // Client data shared with the WASM module
+  static constexpr SIMCONNECT_CLIENT_DATA_ID sharedClientDataID = 1;
+  static constexpr SIMCONNECT_CLIENT_DATA_ID responsesClientDataID = 2;
+  static constexpr SIMCONNECT_CLIENT_DATA_DEFINITION_ID commandDefinitionID =
+      12;
+
+  // First and last are inclusive
+  struct IdRange {
+    DWORD first;
+    DWORD last;
+  };
+
+  // The whole block of a mode starting at base
+  static IdRange block(DWORD base) { return {base, base + idBlockSize - 1}; }
+
+  struct Routes {
+    // Matched against uEventID of events and frame events
+    std::vector<IdRange> events;
+    // Matched against dwRequestID of SIMOBJECT_DATA and _BYTYPE
+    std::vector<IdRange> objectData;
+    // Matched against dwRequestID of CLIENT_DATA
+    std::vector<IdRange> clientData;
+  };
+
+  // Keeps the hub locked, every call on the shared handle has to be made
+  // while a Session is held
+  class Session {
+   public:
+    HANDLE handle() const { return sessionHandle; }
+    // False when the session the subscriber set up on has ended, the
+    // subscriber has to connect() again
+    bool valid() const { return isValid; }
+
+   private:
+    friend class SimConnectHub;
+    Session(std::mutex &mutex, HANDLE handle, bool valid)
+        : lock(mutex), sessionHandle(handle), isValid(valid) {}
+
+    std::unique_lock<std::mutex> lock;
+    HANDLE sessionHandle;
+    bool isValid;
+  };
+
+  static SimConnectHub &instance();
+
+  // Returns the ID the subscriber passes to the other calls. proc is
+  // called with context for every message routed to the subscriber.
+  int subscribe(DispatchProc proc, void *context, Routes routes);
+  // The session is closed once the last subscriber is gone
+  void unsubscribe(int subscriber);
+
+  // Blocks until the shared session is open, opening it when no other
+  // subscriber is at it already. Returns false when abort was set first.
+  // The subscriber does its own setup with a Session afterwards.
+  bool connect(int subscriber, const bool &abort,
+               const std::function<void()> &idle = nullptr);
+
+  Session lock(int subscriber);
+
+  // Pulls what SimConnect has queued into the mailboxes and runs the
+  // subscriber's DispatchProc on its own, after the hub was unlocked.
+  // Returns false when the session ended, after a QUIT or when SimConnect
+  // failed.
+  bool dispatch(int subscriber);
+
+  // What the subscriber waits on before it calls dispatch(), pass them to
+  // SerialPort::waitForData together with its boards
+  std::array<SerialPort::NativeHandle, 2> wakeHandles(int subscriber);
+
+  // Call with a Session held. True the first time a client data
+  // definition is claimed in this session, modes that map the same output
+  // share its definition instead of adding it twice.
+  bool claimClientDataDefinition(SIMCONNECT_CLIENT_DATA_DEFINITION_ID id);
+
+ private:
+  struct Subscriber {
+    bool active = false;
+    DispatchProc proc = nullptr;
+    void *context = nullptr;
+    Routes routes;
+    unsigned generation = 0;
+    // Messages waiting for the subscriber, each one an 8 byte header with
+    // its size followed by the message padded to 8 bytes
+    std::vector<char> mailbox;
+    // Only touched by the subscriber's own thread
+    std::vector<char> delivering;
+    // Signalled when the mailbox gets mail or the session ends
+    SerialPort::NativeHandle wakeEvent;
+  };
+
+  SimConnectHub();
+
+  static void CALLBACK route(SIMCONNECT_RECV *data, DWORD size,
+                             void *context);
+  void post(Subscriber &subscriber, const SIMCONNECT_RECV *data, DWORD size);
+  void deliver(Subscriber &subscriber);
+  void setUpSession();
+  void endSession();
+  bool current(const Subscriber &subscriber) const {
+    return open && subscriber.generation == generation;
+  }
+
+  std::mutex mutex;
+  // Held by the subscriber that is trying to open the session
+  std::mutex openMutex;
+  SimConnectReconnector reconnector{"BitsAndDroidsConnector"};
+  // Handed to SimConnect_Open, signalled by SimConnect
+  SerialPort::NativeHandle sessionEvent;
+  HANDLE handle = nullptr;
+  bool open = false;
+  bool quitReceived = false;
+  unsigned generation = 0;
+  // A deque so a subscriber that delivers without the lock keeps its entry
+  // when another one subscribes
+  std::deque<Subscriber> subscribers;
+  std::unordered_set<SIMCONNECT_CLIENT_DATA_DEFINITION_ID> claimedDefinitions;
+};
+
+#endif  // SIMCONNECTHUB_H
@@ -0,0 +1,37 @@
+#ifndef SIMCONNECTRECONNECTOR_H
+#define SIMCONNECTRECONNECTOR_H
+
+#include <headers/SimConnect.h>
+#include <windows.h>
+
+#include <functional>
+#include <random>
+
+// Opens the SimConnect connection of a worker. While the sim isn't running
+// the attempts are spaced out instead of spinning: the wait starts at
+// simConnectRetryMinMs and doubles up to simConnectRetryMaxMs, with up to a
+// quarter of random jitter so the workers don't all knock at the same
+// moment once the sim comes up.
+class SimConnectReconnector {
+ public:
+  explicit SimConnectReconnector(const char *name);
+
+  // Blocks until the connection is open or abort is set; returns false when
+  // it gave up because of abort. The wait is cut into slices of
+  // serialWaitTimeoutMs so a stop request is still noticed quickly, idle is
+  // called once per slice for work that can't wait for the sim.
+  // SimConnect signals eventHandle whenever it has messages queued.
+  bool open(HANDLE *handle, const bool &abort,
+            const std::function<void()> &idle = nullptr,
+            HANDLE eventHandle = nullptr);
+
+  // Attempts since the last successful open
+  int failedAttempts() const { return attempts; }
+
+ private:
+  const char *name;
+  int attempts = 0;
+  std::minstd_rand random;
+};
+
+#endif  // SIMCONNECTRECONNECTOR_H
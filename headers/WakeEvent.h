@@ -0,0 +1,16 @@
+#ifndef WAKEEVENT_H
+#define WAKEEVENT_H
+
+#include <headers/SerialPort.hpp>
+
+// Events a thread waits on through SerialPort::waitForData next to its
+// boards, for work that isn't serial input: SimConnect messages, a mode's
+// mailbox or queued input records. Auto-reset events on Windows, eventfds
+// elsewhere.
+SerialPort::NativeHandle createWakeEvent();
+void closeWakeEvent(SerialPort::NativeHandle event);
+// Safe to call from any thread
+void signalWakeEvent(SerialPort::NativeHandle event);
+void resetWakeEvent(SerialPort::NativeHandle event);
+
+#endif  // WAKEEVENT_H
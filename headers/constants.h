@@ -1,10 +1,52 @@
 #ifndef CONSTANTS_H
 #define CONSTANTS_H
+
+#include <cstddef>
+
 namespace constants {
 inline constexpr char VERSION[]{"1.1.0"};
 inline constexpr int supportedEngines{4};
 inline constexpr int supportedMixtureLevers{2};
 inline constexpr int supportedPropellerLevers{2};
+// Boards send 10-bit analog readings (0 - 1023)
+inline constexpr int axisResolution{1024};
+// Upper bound for how long the workers block on serial input, this is how
+// quickly they notice a stop request
+inline constexpr unsigned long serialWaitTimeoutMs{50};
+// How often the input worker prints port throughput and queue depth
+inline constexpr int inputStatsIntervalMs{10000};
+// While axes wait for the next sim frame the workers poll SimConnect this
+// often, values are never held back longer than axisMaxHoldMs
+inline constexpr unsigned long axisFramePollMs{4};
+inline constexpr int axisMaxHoldMs{50};
+// Encoder detents within this window are sent as one event, spinning at
+// least encoderFastDetents in a window switches to the larger step
+inline constexpr int encoderWindowMs{30};
+inline constexpr int encoderFastDetents{3};
+// How long the sim gets to report a value we just set before its updates
+// are trusted again
+inline constexpr int encoderEchoMs{250};
+// How long every board gets to answer the optional handshake probe
+inline constexpr int boardHandshakeTimeoutMs{1000};
+// A board that dropped off is reopened after portReconnectMinMs, every
+// failed attempt doubles the wait up to portReconnectMaxMs
+inline constexpr int portReconnectMinMs{250};
+inline constexpr int portReconnectMaxMs{8000};
+// How often the workers ask the OS whether their boards are still there
+inline constexpr int portHealthCheckMs{100};
+// Wait between attempts to reach a sim that isn't running, doubled after
+// every failed attempt up to simConnectRetryMaxMs
+inline constexpr int simConnectRetryMinMs{250};
+inline constexpr int simConnectRetryMaxMs{4000};
+// The output lines of one dispatch go to a board in writes of at most this
+// many bytes
+inline constexpr size_t outputFlushMaxBytes{256};
+// How often the output and dual workers print the writes per board
+inline constexpr int outputStatsIntervalMs{10000};
+// Outputs in the every update rate class are requested every third visual
+// frame, at 60 fps they change at most this often. The 10 Hz and 1 Hz classes
+// have requests of their own.
+inline constexpr int outputSimUpdateHz{20};
 
 }  // namespace constants
 #endif  // CONSTANTS_H
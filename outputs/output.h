@@ -5,6 +5,8 @@
 
 #include <QJsonObject>
 
+#include "outputschedule.h"
+
 class Output
 
 {
@@ -32,6 +34,9 @@ class Output
   int getPrefix() { return this->prefix; };
   int getType() { return this->type; };
   QString getCbText() { return cbText; };
+  // Taken from the catalog, a saved set doesn't keep its own copy
+  void setSchedule(OutputSchedule scheduleToSet) { schedule = scheduleToSet; }
+  const OutputSchedule &getSchedule() const { return schedule; }
   QJsonObject toJson() const;
 
  private:
@@ -44,6 +49,7 @@ class Output
   QString cbText;
   int prefix;
   int type;
+  OutputSchedule schedule;
 };
 
 #endif  // OUTPUT_H
@@ -19,6 +19,7 @@ class outputBundle {
   };
   const char *getSerialPortString() { return portString; }
   SerialPort *getSerialPort() { return this->arduino; };
+  const QMap<int, Output *> &getOutputsInSet() const { return outputsInSet; }
   bool isOutputInBundle(int id);
 
  private:
@@ -7,6 +7,28 @@
 #include <fstream>
 #include <iostream>
 
+namespace {
+
+// The "priority" and "maxRate" of an entry in the catalog, entries without
+// them are sent at normal priority on every update
+OutputSchedule readSchedule(const QJsonObject &obj) {
+  OutputSchedule schedule;
+  const QString priority = obj.value("priority").toString();
+  if (priority == "high") {
+    schedule.priority = OutputSchedule::HIGH;
+  } else if (priority == "normal") {
+    schedule.priority = OutputSchedule::NORMAL;
+  } else if (priority == "low") {
+    schedule.priority = OutputSchedule::LOW;
+  }
+  if (obj.contains("maxRate")) {
+    schedule.maxRateHz = obj.value("maxRate").toDouble();
+  }
+  return schedule;
+}
+
+}  // namespace
+
 outputHandler::outputHandler() { readOutputs(); }
 
 void outputHandler::addCategoryString(QString category) {
@@ -73,6 +95,7 @@ void outputHandler::readOutputs() {
       Output *foundOutput =
           new Output(JSONid, JSONoutputName, JSONmetric, JSONupdateEvery,
                      JSONdataType, JSONcbText, prefix, type);
+      foundOutput->setSchedule(readSchedule(obj));
       outputCategory->append(*foundOutput);
       availableOutputs.insert(foundOutput->getId(), foundOutput);
 
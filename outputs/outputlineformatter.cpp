@@ -0,0 +1,62 @@
+#include "outputlineformatter.h"
+
+#include <charconv>
+#include <cstdio>
+#include <cstring>
+
+std::string OutputLineFormatter::wirePrefix(int prefix) {
+  std::string formatted = std::to_string(prefix);
+  if (prefix < 1000) {
+    formatted += ' ';
+  }
+  return formatted;
+}
+
+std::string_view OutputLineFormatter::format(char *buffer,
+                                             std::string_view prefix,
+                                             float value,
+                                             ValueFormat valueFormat) {
+  if (prefix.size() >= maxLineLength) {
+    return {};
+  }
+  char *const first = buffer;
+  // One byte stays free for the newline
+  char *const last = first + maxLineLength - 1;
+  std::memcpy(first, prefix.data(), prefix.size());
+  char *end = first + prefix.size();
+
+  switch (valueFormat) {
+    case INTEGER:
+    case BOOLEAN: {
+      const int intValue = valueFormat == BOOLEAN ? value != 0
+                                                  : static_cast<int>(value);
+      const auto result = std::to_chars(end, last, intValue);
+      if (result.ec != std::errc()) {
+        return {};
+      }
+      end = result.ptr;
+      break;
+    }
+    case DECIMAL: {
+#ifdef __cpp_lib_to_chars
+      const auto result =
+          std::to_chars(end, last, value, std::chars_format::fixed, 6);
+      if (result.ec != std::errc()) {
+        return {};
+      }
+      end = result.ptr;
+#else
+      // Toolchains without floating point to_chars, snprintf doesn't
+      // allocate either
+      const int written = std::snprintf(end, last - end + 1, "%f", value);
+      if (written < 0 || written > last - end) {
+        return {};
+      }
+      end += written;
+#endif
+      break;
+    }
+  }
+  *end++ = '\n';
+  return std::string_view(first, end - first);
+}
@@ -0,0 +1,32 @@
+#ifndef OUTPUTLINEFORMATTER_H
+#define OUTPUTLINEFORMATTER_H
+
+#include <string>
+#include <string_view>
+
+// Formats the lines sent to the boards, the prefix followed by the value
+// and a newline, into a buffer the caller provides. Nothing is allocated.
+class OutputLineFormatter {
+ public:
+  enum ValueFormat {
+    INTEGER,
+    // Six decimals, like std::to_string
+    DECIMAL,
+    // 0 or 1
+    BOOLEAN,
+  };
+
+  // Fits the longest prefix and a float with six decimals
+  static constexpr size_t maxLineLength = 64;
+
+  // The prefix as it goes on the wire, prefixes below 1000 are followed by
+  // a space. Done once when the sets are loaded.
+  static std::string wirePrefix(int prefix);
+
+  // Writes the line to buffer, which has room for maxLineLength bytes.
+  // Returns the line, empty when it doesn't fit.
+  static std::string_view format(char *buffer, std::string_view prefix,
+                                 float value, ValueFormat valueFormat);
+};
+
+#endif  // OUTPUTLINEFORMATTER_H
@@ -1,17 +1,46 @@
 #include "outputmapper.h"
 
+#include <headers/SimConnectHub.h>
 #include <windows.h>
 
+#include <algorithm>
 #include <iostream>
+#include <iterator>
+#include <unordered_set>
+
+namespace {
+struct RateClassRequest {
+  SIMCONNECT_PERIOD period;
+  DWORD interval;
+};
+
+// Indexed by OutputSchedule::RateClass. Every third visual frame is
+// constants::outputSimUpdateHz at 60 fps, every sixth is 10 Hz.
+constexpr RateClassRequest rateClassRequests[OutputSchedule::rateClasses] = {
+    {SIMCONNECT_PERIOD_VISUAL_FRAME, 3},
+    {SIMCONNECT_PERIOD_VISUAL_FRAME, 6},
+    {SIMCONNECT_PERIOD_SECOND, 0},
+};
+}  // namespace
 
 outputMapper::outputMapper() {}
 void outputMapper::mapOutputs(QList<Output*> outputToMap,
-                              HANDLE outputConnect) {
+                              HANDLE outputConnect,
+                              SIMCONNECT_DATA_DEFINITION_ID firstDefinition) {
   HRESULT hr;
+  this->firstDefinition = firstDefinition;
+  std::fill(std::begin(classMapped), std::end(classMapped), false);
   int offsetCounter = 0;
+  std::unordered_set<int> mappedIds;
   std::cout << "OUTPUTS TO MAP " << outputToMap.size() << std::endl;
   for (auto& i : outputToMap) {
     if (i->getType() == 99 || i->getType() == 98 || i->getType() == 97) {
+      // When another mode mapped this output already its updates are
+      // routed to both
+      if (!SimConnectHub::instance().claimClientDataDefinition(
+              i->getPrefix())) {
+        continue;
+      }
       std::cout << "MAPPED " << i->getType() << "OffSET: " << i->getOffset()
                 << " ID " << i->getId() << std::endl;
       SimConnect_AddToClientDataDefinition(outputConnect, i->getPrefix(),
@@ -23,12 +52,34 @@ void outputMapper::mapOutputs(QList<Output*> outputToMap,
           SIMCONNECT_CLIENT_DATA_REQUEST_FLAG_CHANGED, 0, 0, 0);
       offsetCounter++;
 
-    } else {
+    } else if (mappedIds.insert(i->getId()).second) {
+      // An output in several sets is added once, the router sends it to
+      // every board
+      const int rateClass = i->getSchedule().rateClass();
       hr = SimConnect_AddToDataDefinition(
-          outputConnect, 0, i->getOutputName().c_str(), i->getMetric().c_str(),
+          outputConnect, firstDefinition + rateClass,
+          i->getOutputName().c_str(), i->getMetric().c_str(),
           SIMCONNECT_DATATYPE_FLOAT32, i->getUpdateEvery(), i->getId());
+      classMapped[rateClass] = true;
     }
 
     std::cout << i->getId() << std::endl;
   }
 }
+
+void outputMapper::requestOutputs(
+    HANDLE outputConnect, SIMCONNECT_DATA_REQUEST_ID firstRequest) const {
+  for (int rateClass = 0; rateClass < OutputSchedule::rateClasses;
+       rateClass++) {
+    // An empty definition would only get an exception back
+    if (!classMapped[rateClass]) {
+      continue;
+    }
+    SimConnect_RequestDataOnSimObject(
+        outputConnect, firstRequest + rateClass, firstDefinition + rateClass,
+        SIMCONNECT_OBJECT_ID_USER, rateClassRequests[rateClass].period,
+        SIMCONNECT_DATA_REQUEST_FLAG_CHANGED |
+            SIMCONNECT_DATA_REQUEST_FLAG_TAGGED,
+        0, rateClassRequests[rateClass].interval);
+  }
+}
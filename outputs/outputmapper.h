@@ -9,15 +9,28 @@
 #include <windows.h>
 
 #include "output.h"
+#include "outputschedule.h"
 
 class outputMapper {
  public:
   outputMapper();
 
-  void mapOutputs(QList<Output *> outputToMap, HANDLE outputConnect);
+  // Sim variables go to the definition of their rate class, counted from
+  // firstDefinition, outputs read through the WASM module get a client
+  // data definition named after their prefix. Call with a
+  // SimConnectHub::Session held.
+  void mapOutputs(QList<Output *> outputToMap, HANDLE outputConnect,
+                  SIMCONNECT_DATA_DEFINITION_ID firstDefinition);
+  // Requests every rate class that got sim variables at its own period,
+  // class n uses firstRequest + n. Call with a SimConnectHub::Session held.
+  void requestOutputs(HANDLE outputConnect,
+                      SIMCONNECT_DATA_REQUEST_ID firstRequest) const;
 
  private:
   void mapOutputs();
+
+  SIMCONNECT_DATA_DEFINITION_ID firstDefinition = 0;
+  bool classMapped[OutputSchedule::rateClasses] = {};
 };
 
 #endif  // OUTPUTMAPPER_H
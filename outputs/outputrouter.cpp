@@ -0,0 +1,24 @@
+#include "outputrouter.h"
+
+#include "outputlineformatter.h"
+
+void OutputRouter::build(const QList<outputBundle *> &bundles) {
+  routes.clear();
+  for (int port = 0; port < bundles.size(); port++) {
+    for (Output *output : bundles[port]->getOutputsInSet().values()) {
+      const int id = output->getId();
+      if (id < 0) {
+        continue;
+      }
+      if (id >= static_cast<int>(routes.size())) {
+        routes.resize(id + 1);
+      }
+      Route &route = routes[id];
+      route.type = output->getType();
+      route.prefix = output->getPrefix();
+      route.wirePrefix = OutputLineFormatter::wirePrefix(route.prefix);
+      route.schedule = output->getSchedule();
+      route.ports.push_back(port);
+    }
+  }
+}
@@ -0,0 +1,43 @@
+#ifndef OUTPUTROUTER_H
+#define OUTPUTROUTER_H
+
+#include <QList>
+#include <string>
+#include <vector>
+
+#include "outputbundle.h"
+#include "outputschedule.h"
+
+// Which boards show an output, built once when a worker starts so routing a
+// datum is a single index by its id instead of a lookup per bundle. An
+// output that is in several sets goes to every board that has one of them.
+class OutputRouter {
+ public:
+  struct Route {
+    // The output type, picks the conversion
+    int type = -1;
+    int prefix = -1;
+    // Preformatted by OutputLineFormatter::wirePrefix
+    std::string wirePrefix;
+    OutputSchedule schedule;
+    // Indexes into the worker's ports, bundle i is shown on port i
+    std::vector<int> ports;
+  };
+
+  void build(const QList<outputBundle *> &bundles);
+  void clear() { routes.clear(); }
+
+  // nullptr when none of the bundles has the output
+  const Route *find(int id) const {
+    if (id < 0 || id >= static_cast<int>(routes.size()) ||
+        routes[id].ports.empty()) {
+      return nullptr;
+    }
+    return &routes[id];
+  }
+
+ private:
+  std::vector<Route> routes;
+};
+
+#endif  // OUTPUTROUTER_H
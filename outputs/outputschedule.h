@@ -0,0 +1,53 @@
+#ifndef OUTPUTSCHEDULE_H
+#define OUTPUTSCHEDULE_H
+
+#include <headers/constants.h>
+
+#include <algorithm>
+#include <cstddef>
+
+// How an output shares its board's serial line with the others, from the
+// output catalog. When a set needs more than the baud rate carries, the
+// high priority outputs are sent first and the low ones get what is left.
+struct OutputSchedule {
+  enum Priority { HIGH, NORMAL, LOW };
+  // The sim data is requested per rate class, an output goes in the
+  // slowest class that still keeps up with its max rate
+  enum RateClass { EVERY_UPDATE, TEN_HZ, ONE_HZ };
+  static constexpr int rateClasses = ONE_HZ + 1;
+
+  int priority = NORMAL;
+  // Changes are sent at most this often, 0 sends every change
+  float maxRateHz = 0;
+
+  int rateClass() const {
+    if (maxRateHz <= 0 || maxRateHz > 10) {
+      return EVERY_UPDATE;
+    }
+    return maxRateHz > 1 ? TEN_HZ : ONE_HZ;
+  }
+};
+
+// The byte budget of a board, shared by the writers that pace themselves to
+// it and the set editor that reports it
+class OutputBudget {
+ public:
+  // 8N1 puts ten bits on the wire for every byte. A baud rate that isn't
+  // set counts as the 115200 SerialPort uses then.
+  static double portBytesPerSecond(int baudRate) {
+    return (baudRate > 0 ? baudRate : 115200) / 10.0;
+  }
+
+  // The most an output can need: a line of lineLength bytes for every sim
+  // update, or at its max rate when that is lower
+  static double outputBytesPerSecond(size_t lineLength,
+                                     const OutputSchedule &schedule) {
+    double rate = constants::outputSimUpdateHz;
+    if (schedule.maxRateHz > 0) {
+      rate = std::min(rate, static_cast<double>(schedule.maxRateHz));
+    }
+    return lineLength * rate;
+  }
+};
+
+#endif  // OUTPUTSCHEDULE_H
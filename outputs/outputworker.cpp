@@ -3,11 +3,15 @@
 
 #include "outputworker.h"
 
+#include <headers/SerialPortOpener.h>
+#include <headers/SimConnectHub.h>
+#include <headers/constants.h>
 #include <qsettings.h>
 #include <qstandardpaths.h>
 #include <tchar.h>
 #include <windows.h>
 
+#include <chrono>
 #include <cstdio>
 #include <iostream>
 #include <string>
@@ -18,7 +22,6 @@ float currentSpeed;
 int eps = 1;
 
 bool lastConnectionState = false;
-SerialPort *ports[10];
 
 // SIMCONNECT_OBJECT_ID objectID = SIMCONNECT_OBJECT_ID_USER;
 //// Attempt at WASM
@@ -56,18 +59,23 @@ SimVar testVar = {1000, sizeof(float), 1.0f};
 SimVar testVarB = {1001, sizeof(float) * 2, 1.0f};
 SimVar simVars[2] = {testVar, testVarB};
 
-enum EVENT_ID { EVENT_SIM_START, EVENT_WASM = 3 };
+// Kept in the output block of the shared SimConnect session
+enum EVENT_ID {
+  EVENT_SIM_START = SimConnectHub::outputIdBase,
+  EVENT_WASM = SimConnectHub::outputIdBase + 3
+};
 
+// DEFINITION_PDR and REQUEST_PDR are the first of one per rate class
 enum DATA_DEFINE_ID {
-  DEFINITION_PDR,
-  DEFINITION_STRING,
-  DEFINITION_WASM_REQUEST = 13
+  DEFINITION_PDR = SimConnectHub::outputIdBase,
+  DEFINITION_STRING = DEFINITION_PDR + OutputSchedule::rateClasses,
+  DEFINITION_WASM_REQUEST = SimConnectHub::outputIdBase + 13
 
 };
 
 enum DATA_REQUEST_ID {
-  REQUEST_PDR,
-  REQUEST_STRING,
+  REQUEST_PDR = SimConnectHub::outputIdBase,
+  REQUEST_STRING = REQUEST_PDR + OutputSchedule::rateClasses,
   REQUEST_WASM,
 };
 
@@ -77,53 +85,18 @@ SerialPort *arduinoTest;
 
 OutputWorker::OutputWorker() {}
 
-void sendToArduino(float received, const std::string &prefix, int index,
-                   int mode) {
-  int intVal;
-  std::string prefixString = prefix;
-  if (stoi(prefix) < 1000) {
-    prefixString += " ";
-  }
-  std::string input_string;
-
-  if (mode != 4) {
-    cout << "0 checked" << endl;
-    intVal = static_cast<int>(received);
-  } else {
-    if (received == 0) {
-      intVal = 0;
-    } else {
-      intVal = 1;
-    }
-    input_string = prefixString + std::to_string(intVal);
-  }
-
+void sendToArduino(OutputWriters *writers, float received,
+                   const OutputRouter::Route &route, int index, int mode) {
+  auto valueFormat = OutputLineFormatter::INTEGER;
   if (mode == 3) {
-    input_string = prefixString + std::to_string(received);
-  } else {
-    const auto value = intVal;
-    input_string = prefixString + std::to_string(value);
-  }
-
-  cout << "size: " << input_string.size() << endl;
-  auto *const c_string = new char[input_string.size() + 1];
-  std::copy(input_string.begin(), input_string.end(), c_string);
-  c_string[input_string.size()] = '\n';
-  cout << strlen(c_string) << endl;
-  cout << input_string << endl;
-
-  if (mode == 1) {
-    if (received < 0) {
-      ports[index]->writeSerialPort(c_string, 7);
-    } else {
-      ports[index]->writeSerialPort(c_string, 6);
-    }
-  } else {
-    cout << "WHERE DOEST THIS COME FROM " << c_string << endl;
-    ports[index]->writeSerialPort(c_string, input_string.size() + 1);
+    valueFormat = OutputLineFormatter::DECIMAL;
+  } else if (mode == 4) {
+    valueFormat = OutputLineFormatter::BOOLEAN;
   }
-  input_string.clear();
-  delete[] c_string;
+  // The board's writer sends it once the dispatch is done, unless a newer
+  // value replaced it by then
+  writers->store(index, route.wirePrefix, received, valueFormat,
+                 route.schedule);
 }
 
 void sendCharToArduino(const char *received, const std::string &prefix) {
@@ -159,34 +132,34 @@ void OutputWorker::MyDispatchProcRD(SIMCONNECT_RECV *pData, DWORD cbData,
 
   auto *outputCast = static_cast<OutputWorker *>(pContext);
 
-  int updatePerXFrames = 3;
-
   switch (pData->dwID) {
     case SIMCONNECT_RECV_ID_EVENT: {
       auto *evt = (SIMCONNECT_RECV_EVENT *)pData;
 
       switch (evt->uEventID) {
-        case 3: {
+        case EVENT_WASM: {
           qDebug() << "EVENT WASM TRIGGERED";
           break;
         }
-        case EVENT_SIM_START:
-
-          hr = SimConnect_RequestDataOnSimObject(
-              hSimConnect, REQUEST_PDR, DEFINITION_PDR,
-              SIMCONNECT_OBJECT_ID_USER, SIMCONNECT_PERIOD_VISUAL_FRAME,
-              SIMCONNECT_DATA_REQUEST_FLAG_CHANGED |
-                  SIMCONNECT_DATA_REQUEST_FLAG_TAGGED,
-              0, updatePerXFrames);
+        case EVENT_SIM_START: {
+          // Dispatched without the hub's lock, the requests take it
+          auto session =
+              SimConnectHub::instance().lock(outputCast->hubSubscriber);
+          if (!session.valid()) {
+            break;
+          }
+          outputCast->outputMapper->requestOutputs(session.handle(),
+                                                   REQUEST_PDR);
 
           hr = SimConnect_RequestDataOnSimObject(
-              hSimConnect, REQUEST_STRING, DEFINITION_STRING,
+              session.handle(), REQUEST_STRING, DEFINITION_STRING,
               SIMCONNECT_OBJECT_ID_USER, SIMCONNECT_PERIOD_VISUAL_FRAME,
               SIMCONNECT_DATA_REQUEST_FLAG_CHANGED |
                   SIMCONNECT_DATA_REQUEST_FLAG_TAGGED,
               0, 15);
 
           break;
+        }
 
         default:
           qDebug() << evt->uEventID << "que";
@@ -196,30 +169,28 @@ void OutputWorker::MyDispatchProcRD(SIMCONNECT_RECV *pData, DWORD cbData,
     }
     case SIMCONNECT_RECV_ID_CLIENT_DATA: {
       auto pObjData = (SIMCONNECT_RECV_CLIENT_DATA *)pData;
-      int bundle = 0;
-
-      Output *output =
-          outputCast->outputHandler.findOutputById(pObjData->dwRequestID);
-      for (int i = 0; i < outputCast->outputBundles->size(); i++) {
-        if (outputCast->outputBundles->at(i)->isOutputInBundle(
-                output->getId())) {
-          qDebug() << "FOUND IN SET";
-          bundle = i;
+      // Outputs only the dual mode mapped arrive here as well, they have no
+      // route and are dropped
+      const auto *route = outputCast->router.find(pObjData->dwRequestID);
+      if (route != nullptr && pObjData->dwRequestID > 999 &&
+          pObjData->dwRequestID < 2000) {
+        for (int port : route->ports) {
+          sendToArduino(&outputCast->writers, pObjData->dwData, *route, port,
+                        4);
         }
       }
-      qDebug() << "DATA: " << pObjData->dwData << "ID: " << pObjData->dwID
-               << pObjData->dwRequestID << pObjData->dwDefineID
-               << pObjData->dwObjectID;
-      if (pObjData->dwRequestID > 999 && pObjData->dwRequestID < 2000) {
-        sendToArduino(pObjData->dwData, std::to_string(pObjData->dwRequestID),
-                      bundle, 4);
-      }
     } break;
 
     case SIMCONNECT_RECV_ID_SIMOBJECT_DATA: {
       auto *pObjData = (SIMCONNECT_RECV_SIMOBJECT_DATA *)pData;
+      DWORD requestID = pObjData->dwRequestID;
+      // Every rate class has its own request, they all carry tagged outputs
+      if (requestID > REQUEST_PDR &&
+          requestID < REQUEST_PDR + OutputSchedule::rateClasses) {
+        requestID = REQUEST_PDR;
+      }
 
-      switch (pObjData->dwRequestID) {
+      switch (requestID) {
         case REQUEST_STRING: {
           auto *pS = (Struct1 *)&pObjData->dwData;
           sendCharToArduino(pS->title, "999");
@@ -232,90 +203,58 @@ void OutputWorker::MyDispatchProcRD(SIMCONNECT_RECV *pData, DWORD cbData,
           auto pS = reinterpret_cast<StructDatum *>(&pObjData->dwData);
 
           while (count < (int)pObjData->dwDefineCount) {
-            string valString = std::to_string(pS->datum[count].value);
-            int id = pS->datum[count].id;
-            Output *output = outputCast->outputHandler.findOutputById(id);
-            int bundle = 0;
-
-            for (int i = 0; i < outputCast->outputBundles->size(); i++) {
-              if (outputCast->outputBundles->at(i)->isOutputInBundle(
-                      output->getId())) {
-                qDebug() << "FOUND IN SET";
-                bundle = i;
-              }
+            const auto *route = outputCast->router.find(pS->datum[count].id);
+            if (route == nullptr) {
+              ++count;
+              continue;
             }
 
-            //            while (bundle == NULL) {
-            //              if
-            //              (outputCast->outputBundles->at(counter)->isOutputInBundle(
-            //                      output->getId())) {
-            //                bundle = counter;
-            //              }
-            //              counter++;
-            //            }
-
-            qDebug() << "id" << id << "BUNDLE ID" << bundle;
-
-            int mode = output->getType();
-            string prefix = std::to_string(output->getPrefix());
-
-            qDebug() << "MODE" << mode << "PREFIX"
-                     << QString::fromStdString(prefix)
-                     << pS->datum[count].value;
-
-            switch (mode) {
-              case 0: {
-                sendToArduino(pS->datum[count].value, prefix, bundle, 0);
-                break;
-              }
-              case 1: {
-                cout << "daaa" << endl;
-                sendToArduino(pS->datum[count].value * 100, prefix, bundle, 0);
+            // Converted once, then sent to every board that shows it
+            float value = pS->datum[count].value;
+            int mode = 0;
+            bool send = true;
+            switch (route->type) {
+              case 0:
+              case 9:
                 break;
-              }
-              case 2: {
-                sendToArduino(radianToDegree(pS->datum[count].value), prefix,
-                              bundle, 0);
+              case 1:
+                value *= 100;
                 break;
-              }
-              case 3: {
-                sendToArduino(pS->datum[count].value, prefix, bundle, 3);
+              case 2:
+                value = radianToDegree(value);
                 break;
-              }; break;
-              case 4: {
-                sendToArduino(pS->datum[count].value, prefix, bundle, 4);
+              case 3:
+              case 4:
+                mode = route->type;
                 break;
-              }
-              case 5:;
+              case 5:
+                send = false;
                 break;
               case 6: {
-                int inHg = pS->datum[count].value * 1000;
+                int inHg = value * 1000;
                 if (inHg % (inHg / 10) >= 5) {
                   inHg += 10;
                 }
-                sendToArduino(inHg / 10, prefix, bundle, 0);
+                value = inHg / 10;
                 break;
               }
-              case 7: {
-                sendToArduino(pS->datum[count].value * 1.94, prefix, bundle, 0);
+              case 7:
+                value *= 1.94;
                 break;
-              }
-
-              case 8: {
-                sendToArduino(pS->datum[count].value / 1000, prefix, bundle, 0);
+              case 8:
+                value /= 1000;
                 break;
-              }
-              case 9: {
-                qDebug() << "interesting" << pS->datum[count].value;
-                sendToArduino(pS->datum[count].value, prefix, bundle, 0);
-
-                break;
-              }
-
               default:
                 printf("\nUnknown datum ID: %i", pS->datum[count].id);
+                send = false;
                 break;
             }
+            if (send) {
+              for (int port : route->ports) {
+                sendToArduino(&outputCast->writers, value, *route, port,
+                              mode);
+              }
+            }
             ++count;
           }
           break;
@@ -327,7 +266,8 @@ void OutputWorker::MyDispatchProcRD(SIMCONNECT_RECV *pData, DWORD cbData,
     }
 
     case SIMCONNECT_RECV_ID_QUIT: {
-      // quit = 1;
+      // Ends the session, testDataRequest() waits for the sim to come back
+      static_cast<OutputWorker *>(pContext)->connected = false;
       break;
     }
 
@@ -343,78 +283,120 @@ void OutputWorker::testDataRequest() {
 
   abort = false;
   keys = settingsHandler.retrieveKeys("runningOutputcoms");
-  int keySize = keys->size();
-  int succesfullConnected = 0;
   emit(BoardConnectionMade(0, 2));
-  for (int i = 0; i < keySize; i++) {
-    ports[i] = new SerialPort(
-        settingsHandler.retrieveSetting("runningOutputcoms", keys->at(i))
+  std::vector<std::string> portNames;
+  for (const auto &key : *keys) {
+    portNames.push_back(
+        settingsHandler.retrieveSetting("runningOutputcoms", key)
             ->toString()
-            .toStdString()
-            .c_str());
-
-    if (ports[i]->isConnected()) {
+            .toStdString());
+  }
+  closePorts();
+  ports = openSerialPorts(portNames);
+  for (auto *port : ports) {
+    if (port->isConnected()) {
       cout << "CONNECTED" << endl;
       emit(BoardConnectionMade(1, 2));
-      succesfullConnected++;
     } else {
       cout << "NOT CONNECTED" << endl;
     }
   }
-  if (succesfullConnected == keySize) {
+  if (handshakeSerialPorts(ports)) {
     emit(BoardConnectionMade(2, 2));
   }
+  writers.start(ports, constants::outputFlushMaxBytes);
+  router.build(*outputBundles);
+  reconnector.watch(ports);
+
+  auto &hub = SimConnectHub::instance();
+  SimConnectHub::Routes routes;
+  routes.events = {SimConnectHub::block(SimConnectHub::outputIdBase)};
+  routes.objectData = {SimConnectHub::block(SimConnectHub::outputIdBase)};
+  routes.clientData = {{1000, 1999}};
+  hubSubscriber = hub.subscribe(MyDispatchProcRD, this, routes);
 
   connected = false;
-  qDebug() << "attempted";
-  while (!connected && !abort) {
-    emit(GameConnectionMade(1, 2));
-    qDebug() << "attempted";
-    if (SUCCEEDED(
-            SimConnect_Open(&hSimConnect, "outputs", nullptr, 0, nullptr, 0))) {
+  emit(GameConnectionMade(1, 2));
+  // Every pass is one session with the sim. The mappings belong to the
+  // connection, so they are set up again after each reconnect.
+  while (hub.connect(hubSubscriber, abort, [this] { checkPorts(); })) {
+    {
+      auto session = hub.lock(hubSubscriber);
+      if (!session.valid()) {
+        continue;
+      }
+      hSimConnect = session.handle();
       printf("\nConnected to Flight Simulator!");
-      outputMapper->mapOutputs(outputsToMap, hSimConnect);
-      SimConnect_MapClientDataNameToID(hSimConnect, "wasm.responses", 2);
-
-      SimConnect_CreateClientData(hSimConnect, 2, 4096,
-                                  SIMCONNECT_CREATE_CLIENT_DATA_FLAG_DEFAULT);
-
-      SimConnect_AddToClientDataDefinition(hSimConnect, 12, 0, sizeof(dataRecv),
-                                           0, 0);
-
-      emit(GameConnectionMade(2, 2));
-
-      SimConnect_CallDispatch(hSimConnect, MyDispatchProcRD, this);
-
-      connected = true;
-
-      // DATA
-
+      outputMapper->mapOutputs(outputsToMap, hSimConnect, DEFINITION_PDR);
       SimConnect_SubscribeToSystemEvent(hSimConnect, EVENT_SIM_START, "1sec");
-
-      while (!abort) {
-        SimConnect_CallDispatch(hSimConnect, MyDispatchProcRD, this);
-
-        std::this_thread::sleep_for(std::chrono::milliseconds(10));
+    }
+    emit(GameConnectionMade(2, 2));
+    connected = true;
+
+    const auto wakeHandles = hub.wakeHandles(hubSubscriber);
+    auto lastReport = std::chrono::steady_clock::now();
+    while (!abort && connected) {
+      // Wakes as soon as SimConnect has messages for us, the timeout only
+      // paces the board checks
+      SerialPort::waitForData(nullptr, 0, constants::portHealthCheckMs,
+                              wakeHandles.data(), wakeHandles.size());
+      if (!hub.dispatch(hubSubscriber)) {
+        connected = false;
+      }
+      writers.flush();
+      checkPorts();
+
+      const auto now = std::chrono::steady_clock::now();
+      if (now - lastReport >=
+          std::chrono::milliseconds(constants::outputStatsIntervalMs)) {
+        writers.report(
+            std::chrono::duration<double>(now - lastReport).count());
+        lastReport = now;
       }
     }
+    if (!abort) {
+      emit(GameConnectionMade(1, 2));
+    }
   }
+  hub.unsubscribe(hubSubscriber);
+  hubSubscriber = -1;
 
-  SimConnect_Close(hSimConnect);
+  closePorts();
 
-  for (int i = 0; i < keys->size(); i++) {
-    if (ports[i]->isConnected()) {
-      ports[i]->closeSerial();
+  quit();
+}
+
+void OutputWorker::closePorts() {
+  writers.stop();
+  for (auto *port : ports) {
+    if (port->isConnected()) {
+      port->closeSerial();
     }
+    delete port;
   }
+  ports.clear();
+}
 
-  quit();
+// Reopens boards that were unplugged and sends them the latest values, the
+// other boards and the SimConnect session aren't touched
+void OutputWorker::checkPorts() {
+  const auto &reconnected = reconnector.poll();
+  // A board's writer stays off the port until it was reopened
+  for (int index : reconnector.lost()) {
+    writers.suspend(index);
+  }
+  for (int index : reconnected) {
+    writers.resume(index);
+  }
+  if (reconnector.changed()) {
+    emit(BoardConnectionMade(reconnector.allConnected() ? 2 : 1, 2));
+  }
 }
 
 OutputWorker::~OutputWorker() {
-  for (int i = 0; i < keys->size(); i++) {
-    if (ports[i]->isConnected()) {
-      ports[i]->closeSerial();
+  for (auto *port : ports) {
+    if (port->isConnected()) {
+      port->closeSerial();
     }
   }
   abort = true;
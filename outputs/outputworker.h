@@ -11,13 +11,17 @@
 #include <QObject>
 #include <QThread>
 #include <QWaitCondition>
+#include <headers/PortReconnector.h>
 #include <headers/SerialPort.hpp>
+#include <vector>
 
 #include "headers/SimConnect.h"
 #include "output.h"
 #include "outputbundle.h"
 #include "outputhandler.h"
 #include "outputmapper.h"
+#include "outputrouter.h"
+#include "outputwriters.h"
 
 class OutputWorker : public QThread {
   Q_OBJECT
@@ -59,10 +63,19 @@ class OutputWorker : public QThread {
   std::string lastVal;
   std::string lastStatus;
   SerialPort* arduino;
+  // One entry per configured board, indexed like the output bundles
+  std::vector<SerialPort*> ports;
+  PortReconnector reconnector;
+  OutputWriters writers;
+  OutputRouter router;
+  // Our ID with the SimConnectHub while testDataRequest() runs
+  int hubSubscriber = -1;
 
   static void MyDispatchProcRD(SIMCONNECT_RECV* pData, DWORD cbData,
                                void* pContext);
   void testDataRequest();
+  void closePorts();
+  void checkPorts();
 };
 
 #endif  // OUTPUTWORKER_H
@@ -0,0 +1,291 @@
+#include "outputwriters.h"
+
+#include <algorithm>
+#include <cstring>
+#include <iostream>
+#include <string_view>
+
+void OutputWriters::start(const std::vector<SerialPort *> &ports,
+                          size_t maxFlushBytes) {
+  stop();
+  this->maxFlushBytes =
+      std::max(maxFlushBytes, OutputLineFormatter::maxLineLength);
+  writers.clear();
+  stored.assign(ports.size(), 0);
+  for (auto *port : ports) {
+    auto writer = std::make_unique<Writer>();
+    writer->port = port;
+    writer->suspended = !port->isConnected();
+    writer->running = true;
+    writer->bytesPerSecond = OutputBudget::portBytesPerSecond(port->baud());
+    writer->batch.reserve(this->maxFlushBytes);
+    writer->thread = std::thread(&OutputWriters::writePort, this, writer.get());
+    writers.push_back(std::move(writer));
+  }
+}
+
+void OutputWriters::stop() {
+  for (auto &writer : writers) {
+    {
+      std::lock_guard<std::mutex> lock(writer->mutex);
+      writer->running = false;
+    }
+    writer->wake.notify_all();
+  }
+  for (auto &writer : writers) {
+    if (writer->thread.joinable()) {
+      writer->thread.join();
+    }
+  }
+}
+
+bool OutputWriters::store(int port, const std::string &prefix, float value,
+                          OutputLineFormatter::ValueFormat valueFormat,
+                          const OutputSchedule &schedule) {
+  if (port < 0 || port >= static_cast<int>(writers.size())) {
+    return false;
+  }
+  char buffer[OutputLineFormatter::maxLineLength];
+  const auto line =
+      OutputLineFormatter::format(buffer, prefix, value, valueFormat);
+  if (line.empty()) {
+    return false;
+  }
+  Writer &writer = *writers[port];
+  std::lock_guard<std::mutex> lock(writer.mutex);
+  auto found = writer.slotIndex.find(prefix);
+  if (found == writer.slotIndex.end()) {
+    // The first value of an output on this board, every later one reuses
+    // the slot
+    found = writer.slotIndex.emplace(prefix, writer.slotTable.size()).first;
+    Slot &added = writer.slotTable.emplace_back();
+    added.priority = std::clamp(schedule.priority,
+                                static_cast<int>(OutputSchedule::HIGH),
+                                static_cast<int>(OutputSchedule::LOW));
+    if (schedule.maxRateHz > 0) {
+      added.minInterval = std::chrono::duration_cast<Clock::duration>(
+          std::chrono::duration<double>(1.0 / schedule.maxRateHz));
+    }
+  }
+  Slot &slot = writer.slotTable[found->second];
+  if (line == std::string_view(slot.line, slot.length)) {
+    // Sent or about to be, a raw change that converts to the same line
+    writer.stats.bytesSaved.fetch_add(line.size(), std::memory_order_relaxed);
+    return true;
+  }
+  std::memcpy(slot.line, line.data(), line.size());
+  slot.length = line.size();
+  if (!slot.pending) {
+    slot.pending = true;
+    writer.pending.push_back(found->second);
+  } else if (!writer.suspended && Clock::now() >= slot.nextDue) {
+    // Only counted when the board could have had it, not while the output
+    // waits for its max rate
+    writer.stats.overwritten.fetch_add(1, std::memory_order_relaxed);
+  }
+  stored[port] = 1;
+  return true;
+}
+
+void OutputWriters::flush() {
+  for (size_t port = 0; port < stored.size(); port++) {
+    if (stored[port]) {
+      stored[port] = 0;
+      writers[port]->wake.notify_all();
+    }
+  }
+}
+
+void OutputWriters::suspend(int port) {
+  if (port < 0 || port >= static_cast<int>(writers.size())) {
+    return;
+  }
+  Writer &writer = *writers[port];
+  std::unique_lock<std::mutex> lock(writer.mutex);
+  writer.suspended = true;
+  writer.wake.wait(lock, [&writer] { return !writer.writing; });
+}
+
+void OutputWriters::resume(int port) {
+  if (port < 0 || port >= static_cast<int>(writers.size())) {
+    return;
+  }
+  Writer &writer = *writers[port];
+  size_t replayed = 0;
+  {
+    std::lock_guard<std::mutex> lock(writer.mutex);
+    writer.suspended = false;
+    // The board lost its state, it gets every output that has a value
+    for (size_t i = 0; i < writer.slotTable.size(); i++) {
+      writer.slotTable[i].sentLength = 0;
+      writer.slotTable[i].nextDue = {};
+      if (writer.slotTable[i].length > 0 && !writer.slotTable[i].pending) {
+        writer.slotTable[i].pending = true;
+        writer.pending.push_back(i);
+      }
+      replayed += writer.slotTable[i].length > 0 ? 1 : 0;
+    }
+  }
+  writer.wake.notify_all();
+  std::cout << "Replaying " << replayed << " values to board " << port
+            << std::endl;
+}
+
+void OutputWriters::writePort(Writer *writer) {
+  std::unique_lock<std::mutex> lock(writer->mutex);
+  // Bytes the baud rate allows right now, an idle board builds up at most
+  // one full write
+  double budget = maxFlushBytes;
+  auto refilled = Clock::now();
+  while (writer->running) {
+    if (writer->suspended || writer->pending.empty()) {
+      writer->wake.wait(lock);
+      continue;
+    }
+    const auto now = Clock::now();
+    const double elapsed =
+        std::chrono::duration<double>(now - refilled).count();
+    budget = std::min(static_cast<double>(maxFlushBytes),
+                      budget + elapsed * writer->bytesPerSecond);
+    refilled = now;
+
+    auto wakeAt = Clock::time_point::max();
+    const size_t due = collectDue(writer, now, &wakeAt);
+    // A busy board gets full writes at the pace of its baud rate instead of
+    // a line whenever there is room for one
+    const double wanted =
+        std::min(static_cast<double>(due), static_cast<double>(maxFlushBytes));
+    if (due == 0 || budget < wanted) {
+      if (due > 0) {
+        const std::chrono::duration<double> refill(
+            (wanted - budget) / writer->bytesPerSecond);
+        wakeAt = std::min(
+            wakeAt, now + std::chrono::duration_cast<Clock::duration>(refill));
+      }
+      if (wakeAt == Clock::time_point::max()) {
+        writer->wake.wait(lock);
+      } else {
+        writer->wake.wait_until(lock, wakeAt);
+      }
+      continue;
+    }
+
+    takeBatch(writer, now, static_cast<size_t>(budget));
+    budget -= writer->batch.size();
+    writer->writing = true;
+
+    lock.unlock();
+    // A board that is gone loses the batch, the reconnect resumes it with
+    // the latest values
+    writer->port->writeSerialPort(writer->batch.data(),
+                                  writer->batch.size());
+    writer->stats.lines.fetch_add(writer->batchLines,
+                                  std::memory_order_relaxed);
+    writer->stats.bytes.fetch_add(writer->batch.size(),
+                                  std::memory_order_relaxed);
+    writer->stats.writes.fetch_add(1, std::memory_order_relaxed);
+    lock.lock();
+
+    writer->writing = false;
+    // suspend() may be waiting for the write to end
+    writer->wake.notify_all();
+  }
+}
+
+// Call with the writer's mutex held. Drops the pending lines the board has
+// already and returns the bytes of the ones that are due, wakeAt is moved
+// up to when the next one that isn't becomes due.
+size_t OutputWriters::collectDue(Writer *writer, Clock::time_point now,
+                                 Clock::time_point *wakeAt) {
+  size_t due = 0;
+  for (size_t index : writer->pending) {
+    Slot &slot = writer->slotTable[index];
+    // Changed and changed back before the board got it
+    if (std::string_view(slot.line, slot.length) ==
+        std::string_view(slot.sent, slot.sentLength)) {
+      writer->stats.bytesSaved.fetch_add(slot.length,
+                                         std::memory_order_relaxed);
+      slot.pending = false;
+    } else if (now < slot.nextDue) {
+      *wakeAt = std::min(*wakeAt, slot.nextDue);
+    } else {
+      due += slot.length;
+    }
+  }
+  dropSent(writer);
+  return due;
+}
+
+// Call with the writer's mutex held. Fills the batch with the due lines
+// that fit in budget, high priority first, the rest stays pending.
+void OutputWriters::takeBatch(Writer *writer, Clock::time_point now,
+                              size_t budget) {
+  writer->batch.clear();
+  writer->batchLines = 0;
+  const size_t limit = std::min(budget, maxFlushBytes);
+  bool full = false;
+  for (int priority = OutputSchedule::HIGH;
+       priority <= OutputSchedule::LOW && !full; priority++) {
+    for (size_t index : writer->pending) {
+      Slot &slot = writer->slotTable[index];
+      if (!slot.pending || slot.priority != priority || now < slot.nextDue) {
+        continue;
+      }
+      if (writer->batch.size() + slot.length > limit) {
+        full = true;
+        break;
+      }
+      writer->batch.insert(writer->batch.end(), slot.line,
+                           slot.line + slot.length);
+      std::memcpy(slot.sent, slot.line, slot.length);
+      slot.sentLength = slot.length;
+      slot.pending = false;
+      slot.nextDue = now + slot.minInterval;
+      writer->batchLines++;
+    }
+  }
+  dropSent(writer);
+}
+
+void OutputWriters::dropSent(Writer *writer) {
+  writer->pending.erase(
+      std::remove_if(writer->pending.begin(), writer->pending.end(),
+                     [writer](size_t index) {
+                       return !writer->slotTable[index].pending;
+                     }),
+      writer->pending.end());
+}
+
+void OutputWriters::report(double elapsedSeconds) {
+  for (size_t i = 0; i < writers.size(); i++) {
+    Writer &writer = *writers[i];
+    const uint64_t lines = writer.stats.lines.load(std::memory_order_relaxed);
+    const uint64_t bytes = writer.stats.bytes.load(std::memory_order_relaxed);
+    const uint64_t writes =
+        writer.stats.writes.load(std::memory_order_relaxed);
+    const uint64_t overwritten =
+        writer.stats.overwritten.load(std::memory_order_relaxed);
+    const uint64_t bytesSaved =
+        writer.stats.bytesSaved.load(std::memory_order_relaxed);
+    if (lines != writer.reportedLines ||
+        overwritten != writer.reportedOverwritten ||
+        bytesSaved != writer.reportedBytesSaved) {
+      std::cout << "output port " << i << ": "
+                << (lines - writer.reportedLines) / elapsedSeconds
+                << " lines/s "
+                << (writes - writer.reportedWrites) / elapsedSeconds
+                << " writes/s "
+                << 100 * (bytes - writer.reportedBytes) / elapsedSeconds /
+                       writer.bytesPerSecond
+                << "% of the baud rate "
+                << overwritten - writer.reportedOverwritten
+                << " overwritten " << bytesSaved - writer.reportedBytesSaved
+                << " bytes saved" << std::endl;
+    }
+    writer.reportedLines = lines;
+    writer.reportedBytes = bytes;
+    writer.reportedWrites = writes;
+    writer.reportedOverwritten = overwritten;
+    writer.reportedBytesSaved = bytesSaved;
+  }
+}
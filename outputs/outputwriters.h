@@ -0,0 +1,134 @@
+#ifndef OUTPUTWRITERS_H
+#define OUTPUTWRITERS_H
+
+#include <headers/SerialPort.hpp>
+
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+
+#include "outputlineformatter.h"
+#include "outputschedule.h"
+
+// Counters of a single board, written by its writer thread and the
+// dispatching thread and read by whoever reports them
+struct OutputPortStats {
+  std::atomic<uint64_t> lines{0};
+  std::atomic<uint64_t> bytes{0};
+  std::atomic<uint64_t> writes{0};
+  // Values replaced by a newer one before the board got them
+  std::atomic<uint64_t> overwritten{0};
+  // Lines that came out the same as what the board has already, after the
+  // conversion and formatting, and were never written
+  std::atomic<uint64_t> bytesSaved{0};
+};
+
+// Runs one writer thread per output board. The dispatching thread only
+// stores the latest line of every output in the board's slot table, the
+// writer sends whatever changed since its last write. A board that can't
+// keep up skips the values it had no time for instead of building a
+// queue, and never holds up the dispatch or the other boards.
+//
+// A slot keeps its line after it was sent. A line that is the same as the
+// one the board has already isn't sent again, many changes of the raw sim
+// value end up as the same integer. A board that was reopened gets the
+// latest value of every output again.
+//
+// Every writer paces itself to its board's baud rate. Each write is filled
+// from the changed slots with the high priority outputs first, the oldest
+// change first within a priority, and an output isn't sent more often than
+// its max rate. What doesn't fit stays in its slot for the next write.
+class OutputWriters {
+ public:
+  using Clock = std::chrono::steady_clock;
+
+  ~OutputWriters() { stop(); }
+
+  // Starts a writer for every port, a write carries at most maxFlushBytes.
+  // Ports that aren't connected stay suspended until resume().
+  void start(const std::vector<SerialPort *> &ports, size_t maxFlushBytes);
+  void stop();
+
+  // Formats the line into the output's slot on the board. Returns false
+  // when port is out of range or the line didn't fit.
+  bool store(int port, const std::string &prefix, float value,
+             OutputLineFormatter::ValueFormat valueFormat,
+             const OutputSchedule &schedule);
+  // Wakes the writers of the boards that got lines since the last call, so
+  // the lines of a dispatch go out together
+  void flush();
+
+  // For the thread that reopens the ports: suspend() waits for a write in
+  // progress and keeps the writer off the port, resume() lets it send the
+  // latest line of every output again
+  void suspend(int port);
+  void resume(int port);
+
+  const OutputPortStats &portStats(int port) const {
+    return writers[port]->stats;
+  }
+
+  // Prints the throughput, the share of the baud rate it used and the
+  // overwritten values per port since the last report
+  void report(double elapsedSeconds);
+
+ private:
+  struct Slot {
+    char line[OutputLineFormatter::maxLineLength];
+    size_t length = 0;
+    // The line the board got last, empty when it has none
+    char sent[OutputLineFormatter::maxLineLength];
+    size_t sentLength = 0;
+    bool pending = false;
+    int priority = OutputSchedule::NORMAL;
+    Clock::duration minInterval{};
+    // Not sent again before this
+    Clock::time_point nextDue;
+  };
+
+  struct Writer {
+    SerialPort *port = nullptr;
+    std::mutex mutex;
+    std::condition_variable wake;
+    // Guarded by mutex
+    std::vector<Slot> slotTable;
+    std::unordered_map<std::string, size_t> slotIndex;
+    // Slots with a line the board hasn't got yet, oldest change first
+    std::vector<size_t> pending;
+    bool suspended = false;
+    bool writing = false;
+    bool running = false;
+    // Only touched by the writer thread
+    std::vector<char> batch;
+    size_t batchLines = 0;
+    double bytesPerSecond = 0;
+    OutputPortStats stats;
+    uint64_t reportedLines = 0;
+    uint64_t reportedBytes = 0;
+    uint64_t reportedWrites = 0;
+    uint64_t reportedOverwritten = 0;
+    uint64_t reportedBytesSaved = 0;
+    std::thread thread;
+  };
+
+  void writePort(Writer *writer);
+  size_t collectDue(Writer *writer, Clock::time_point now,
+                    Clock::time_point *wakeAt);
+  void takeBatch(Writer *writer, Clock::time_point now, size_t budget);
+  // Removes the slots that aren't pending anymore from the pending list
+  static void dropSent(Writer *writer);
+
+  std::vector<std::unique_ptr<Writer>> writers;
+  // Ports that got lines since the last flush(), dispatching thread only
+  std::vector<char> stored;
+  size_t maxFlushBytes = 0;
+};
+
+#endif  // OUTPUTWRITERS_H
@@ -109,6 +109,10 @@ set SetHandler::fromJson(QJsonDocument *docToConvert) {
         tempObj.value("prefix").toInt(), tempObj.value("type").toInt());
     foundOutput->setOffset(tempObj.value("offset").toInt());
     auto test = outputHandler->getAvailableOutputs();
+    if (test.contains(foundOutput->getId())) {
+      foundOutput->setSchedule(
+          test.value(foundOutput->getId())->getSchedule());
+    }
     if (outputHandler->getAvailableOutputs().size() > 0) {
       if (outputHandler->findOutputById(foundOutput->getType() != -1)) {
         outputsConverted->insert(foundOutput->getId(), foundOutput);
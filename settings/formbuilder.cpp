@@ -1,6 +1,8 @@
 #include "formbuilder.h"
 
 #include <headers/constants.h>
+#include <outputs/outputlineformatter.h>
+#include <outputs/outputschedule.h>
 #include <qcombobox.h>
 #include <settings/settingsranges.h>
 
@@ -469,6 +471,10 @@ QWidget *FormBuilder::generateActiveSet(set *selectedSet) {
   setNameHeader->setFont(headerFont);
   activeSet->addWidget(setNameHeader);
 
+  auto *setBudget = new QLabel(budgetReport(selectedSet->getOutputs()));
+  setBudget->setObjectName("setBudget");
+  activeSet->addWidget(setBudget);
+
   auto *outputGrid = new QGridLayout();
 
   auto gridWidget = new QWidget();
@@ -515,6 +521,56 @@ QWidget *FormBuilder::generateActiveSet(set *selectedSet) {
   return activeWidget;
 }
 
+QString FormBuilder::budgetReport(const QMap<int, Output *> &outputs) {
+  // Read the way SerialPort reads it
+  SettingsHandler settings;
+  int baudRate = 115200;
+  if (!settings.retrieveSetting("com", "CBR")->isNull() &&
+      settings.retrieveSetting("com", "CBR")->toInt() > 0) {
+    baudRate = settings.retrieveSetting("com", "CBR")->toInt();
+  }
+
+  double needed[OutputSchedule::LOW + 1] = {};
+  for (Output *output : outputs.values()) {
+    // A typical line: the prefix, the value and the newline
+    size_t valueLength = 5;
+    if (output->getType() == 3 || output->getType() == 97) {
+      valueLength = 9;
+    } else if (output->getType() == 4 || output->getType() == 99) {
+      valueLength = 1;
+    }
+    const size_t lineLength =
+        OutputLineFormatter::wirePrefix(output->getPrefix()).size() +
+        valueLength + 1;
+    const OutputSchedule &schedule = output->getSchedule();
+    const int priority = std::clamp(schedule.priority, 0,
+                                    static_cast<int>(OutputSchedule::LOW));
+    needed[priority] +=
+        OutputBudget::outputBytesPerSecond(lineLength, schedule);
+  }
+
+  const double total =
+      needed[OutputSchedule::HIGH] + needed[OutputSchedule::NORMAL] +
+      needed[OutputSchedule::LOW];
+  const double available = OutputBudget::portBytesPerSecond(baudRate);
+  QString report =
+      QString("At most %1 of %2 bytes/s at %3 baud (%4%), high %5, "
+              "normal %6, low %7")
+          .arg(qRound(total))
+          .arg(qRound(available))
+          .arg(baudRate)
+          .arg(qRound(100 * total / available))
+          .arg(qRound(needed[OutputSchedule::HIGH]))
+          .arg(qRound(needed[OutputSchedule::NORMAL]))
+          .arg(qRound(needed[OutputSchedule::LOW]));
+  if (total > available) {
+    report +=
+        "\nOver budget: the high priority outputs go first, the others "
+        "update less often when everything changes at once";
+  }
+  return report;
+}
+
 QWidget *FormBuilder::generateSetRow(const set &setForRow) {
   auto *setRowContainer = new QWidget();
   setRowContainer->setSizePolicy(QSizePolicy::Preferred,
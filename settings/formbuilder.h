@@ -53,6 +53,10 @@ class FormBuilder : public QObject {
 
   static QWidget *generateActiveSet(set *selectedSet);
 
+  // What the outputs of a set can send at most against what the baud rate
+  // carries, shown under the set's name in the editor
+  static QString budgetReport(const QMap<int, Output *> &outputs);
+
   static QLabel *generateHeader(const QString &text);
 
   QWidget *generateComSelector(bool setsNeeded, int mode);
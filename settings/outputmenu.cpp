@@ -159,6 +159,11 @@ void OutputMenu::saveEdit() {
     }
   }
 
+  auto *setBudget = ui->widget->findChild<QLabel *>("setBudget");
+  if (setBudget != nullptr) {
+    setBudget->setText(FormBuilder::budgetReport(setToEdit.getOutputs()));
+  }
+
   ui->widget->findChild<QTabWidget *>("outputTabWidget")->setVisible(false);
   ui->widget->adjustSize();
   this->adjustSize();
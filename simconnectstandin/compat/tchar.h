@@ -0,0 +1,6 @@
+#ifndef SIMCONNECTSTANDIN_TCHAR_H
+#define SIMCONNECTSTANDIN_TCHAR_H
+
+// headers/SimConnect.h includes <tchar.h> but uses none of it
+
+#endif  // SIMCONNECTSTANDIN_TCHAR_H
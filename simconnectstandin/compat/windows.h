@@ -0,0 +1,38 @@
+#ifndef SIMCONNECTSTANDIN_WINDOWS_H
+#define SIMCONNECTSTANDIN_WINDOWS_H
+
+// Just enough of the Win32 types for headers/SimConnect.h to compile on
+// other platforms. The sizes match the Windows ABI so the packed SimConnect
+// structs keep their layout.
+
+#include <cstdint>
+
+typedef uint32_t DWORD;
+typedef int32_t HRESULT;
+typedef int BOOL;
+typedef uint8_t BYTE;
+typedef uint16_t WORD;
+typedef int32_t LONG;
+typedef void *HANDLE;
+typedef void *HWND;
+typedef const char *LPCSTR;
+
+typedef struct _GUID {
+  uint32_t Data1;
+  uint16_t Data2;
+  uint16_t Data3;
+  uint8_t Data4[8];
+} GUID;
+
+#define TRUE 1
+#define FALSE 0
+#define MAX_PATH 260
+#define S_OK ((HRESULT)0)
+#define E_FAIL ((HRESULT)0x80004005)
+#define SUCCEEDED(hr) (((HRESULT)(hr)) >= 0)
+#define FAILED(hr) (((HRESULT)(hr)) < 0)
+
+#define CALLBACK
+#define __stdcall
+
+#endif  // SIMCONNECTSTANDIN_WINDOWS_H
@@ -0,0 +1,1211 @@
+#include "simconnectstandin.h"
+
+#include <algorithm>
+#include <cctype>
+#include <cmath>
+#include <condition_variable>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <functional>
+#include <iostream>
+#include <map>
+#include <mutex>
+#include <set>
+#include <sstream>
+#include <thread>
+
+#ifndef _WIN32
+#include <unistd.h>
+#endif
+
+namespace {
+
+using Clock = std::chrono::steady_clock;
+using simconnectstandin::TransmittedEvent;
+
+// Never deliver more than this many seconds of frames in one CallDispatch, a
+// connection that wasn't polled for a while skips ahead instead
+constexpr double maxCatchUpSeconds = 1.0;
+
+// Size of the SIMCONNECT_RECV_*_DATA header without the dwData placeholder
+constexpr size_t dataHeaderSize =
+    sizeof(SIMCONNECT_RECV_SIMOBJECT_DATA) - sizeof(DWORD);
+
+struct Variable {
+  double value = 0;
+  double step = 0;
+  double min = 0;
+  double max = 0;
+  int64_t frame = 0;
+  std::string text;
+};
+
+struct Datum {
+  std::string name;
+  SIMCONNECT_DATATYPE type;
+  float epsilon;
+  DWORD datumID;
+};
+
+struct ClientDatum {
+  DWORD offset;
+  DWORD size;
+  bool isFloat;
+  float epsilon;
+  DWORD datumID;
+};
+
+struct ClientArea {
+  std::vector<char> bytes;
+  uint64_t version = 0;
+};
+
+// Shared by data and client data requests
+struct Request {
+  DWORD requestID = 0;
+  DWORD defineID = 0;
+  DWORD objectOrArea = 0;
+  int period = 0;
+  DWORD flags = 0;
+  DWORD interval = 0;
+  DWORD limit = 0;
+  DWORD sent = 0;
+  int64_t nextFrame = 0;
+  uint64_t seenVersion = 0;
+  bool hasSent = false;
+  // Bytes of every datum as last delivered, for the CHANGED flag
+  std::vector<std::string> lastValues;
+};
+
+struct Connection {
+  std::string name;
+  // The hEventHandle of SimConnect_Open, an eventfd on other platforms
+  HANDLE event = nullptr;
+  int64_t openedNs = 0;
+  int64_t frame = -1;
+  bool opened = false;
+  bool quit = false;
+  std::map<DWORD, std::string> eventNames;
+  std::map<DWORD, std::vector<Datum>> definitions;
+  std::map<DWORD, std::vector<ClientDatum>> clientDefinitions;
+  std::map<DWORD, std::string> clientAreaNames;
+  std::vector<Request> requests;
+  std::vector<Request> clientRequests;
+  std::map<DWORD, std::string> subscriptions;
+  std::set<DWORD> startSent;
+  std::vector<char> outbox;
+  std::vector<size_t> offsets;
+};
+
+struct Sim {
+  std::mutex mutex;
+  std::condition_variable eventRecorded;
+  Clock::time_point start = Clock::now();
+  double frameRate = 60;
+  // Frames are counted from here so a new frame rate doesn't jump back
+  int64_t frameBase = 0;
+  Clock::time_point frameBaseTime = start;
+  std::map<std::string, Variable> variables;
+  std::map<std::string, ClientArea> clientAreas;
+  std::vector<TransmittedEvent> events;
+  std::set<Connection *> connections;
+  int refuseOpens = 0;
+  double quitAfter = 0;
+  DWORD packetID = 0;
+  bool scriptLoaded = false;
+  std::string recordPath;
+  // Signals the event handles once per frame, started by the first
+  // SimConnect_Open that passes one
+  std::thread ticker;
+  std::condition_variable tickerWake;
+  bool stopTicker = false;
+
+  ~Sim();
+};
+
+Sim &sim() {
+  static Sim instance;
+  return instance;
+}
+
+std::string normalize(std::string name) {
+  const auto first = name.find_first_not_of(" \t");
+  const auto last = name.find_last_not_of(" \t\r\n");
+  if (first == std::string::npos) {
+    return {};
+  }
+  name = name.substr(first, last - first + 1);
+  std::transform(name.begin(), name.end(), name.begin(),
+                 [](unsigned char c) { return std::toupper(c); });
+  return name;
+}
+
+int64_t nsSinceStart(const Sim &s) {
+  return std::chrono::duration_cast<std::chrono::nanoseconds>(Clock::now() -
+                                                              s.start)
+      .count();
+}
+
+int64_t currentFrame(const Sim &s) {
+  const std::chrono::duration<double> elapsed = Clock::now() - s.frameBaseTime;
+  return s.frameBase + static_cast<int64_t>(elapsed.count() * s.frameRate);
+}
+
+int framesPerSecond(const Sim &s) {
+  return std::max(1, static_cast<int>(std::lround(s.frameRate)));
+}
+
+double valueAt(const Variable &variable, int64_t frame) {
+  double value = variable.value +
+                 variable.step * static_cast<double>(frame - variable.frame);
+  if (variable.max > variable.min) {
+    const double span = variable.max - variable.min;
+    value = variable.min + std::fmod(value - variable.min, span);
+    if (value < variable.min) {
+      value += span;
+    }
+  }
+  return value;
+}
+
+size_t datumSize(SIMCONNECT_DATATYPE type) {
+  switch (type) {
+    case SIMCONNECT_DATATYPE_INT32:
+    case SIMCONNECT_DATATYPE_FLOAT32:
+      return 4;
+    case SIMCONNECT_DATATYPE_INT64:
+    case SIMCONNECT_DATATYPE_FLOAT64:
+    case SIMCONNECT_DATATYPE_STRING8:
+      return 8;
+    case SIMCONNECT_DATATYPE_STRING32:
+      return 32;
+    case SIMCONNECT_DATATYPE_STRING64:
+      return 64;
+    case SIMCONNECT_DATATYPE_STRING128:
+      return 128;
+    case SIMCONNECT_DATATYPE_STRING256:
+    case SIMCONNECT_DATATYPE_STRINGV:
+      return 256;
+    case SIMCONNECT_DATATYPE_STRING260:
+      return 260;
+    default:
+      return 0;
+  }
+}
+
+bool isString(SIMCONNECT_DATATYPE type) {
+  return type >= SIMCONNECT_DATATYPE_STRING8 &&
+         type <= SIMCONNECT_DATATYPE_STRINGV;
+}
+
+std::string encodeDatum(const Sim &s, const Datum &datum, int64_t frame) {
+  std::string bytes(datumSize(datum.type), '\0');
+  const auto found = s.variables.find(datum.name);
+  if (isString(datum.type)) {
+    if (found != s.variables.end()) {
+      const std::string &text = found->second.text;
+      text.copy(bytes.data(), std::min(text.size(), bytes.size() - 1));
+    }
+    return bytes;
+  }
+
+  const double value =
+      found == s.variables.end() ? 0 : valueAt(found->second, frame);
+  switch (datum.type) {
+    case SIMCONNECT_DATATYPE_INT32: {
+      const auto converted = static_cast<int32_t>(value);
+      std::memcpy(bytes.data(), &converted, sizeof(converted));
+      break;
+    }
+    case SIMCONNECT_DATATYPE_INT64: {
+      const auto converted = static_cast<int64_t>(value);
+      std::memcpy(bytes.data(), &converted, sizeof(converted));
+      break;
+    }
+    case SIMCONNECT_DATATYPE_FLOAT32: {
+      const auto converted = static_cast<float>(value);
+      std::memcpy(bytes.data(), &converted, sizeof(converted));
+      break;
+    }
+    default:
+      std::memcpy(bytes.data(), &value, sizeof(value));
+      break;
+  }
+  return bytes;
+}
+
+double decodeNumber(const std::string &bytes, bool isDouble) {
+  if (isDouble) {
+    double value;
+    std::memcpy(&value, bytes.data(), sizeof(value));
+    return value;
+  }
+  float value;
+  std::memcpy(&value, bytes.data(), sizeof(value));
+  return value;
+}
+
+// Whether a datum moved enough since it was last sent to count as changed
+bool changed(const std::string &last, const std::string &now, bool isFloat,
+             bool isDouble, float epsilon) {
+  if (last.size() != now.size()) {
+    return true;
+  }
+  if (isFloat && epsilon > 0) {
+    return std::fabs(decodeNumber(now, isDouble) -
+                     decodeNumber(last, isDouble)) > epsilon;
+  }
+  return last != now;
+}
+
+void *beginMessage(Connection &connection, size_t size, DWORD id) {
+  // Keep every message 8 byte aligned so doubles can be read in place
+  const size_t offset = (connection.outbox.size() + 7) & ~size_t{7};
+  connection.outbox.resize(offset + size);
+  connection.offsets.push_back(offset);
+  auto *header =
+      reinterpret_cast<SIMCONNECT_RECV *>(connection.outbox.data() + offset);
+  header->dwSize = static_cast<DWORD>(size);
+  header->dwVersion = 5;
+  header->dwID = id;
+  return header;
+}
+
+void queueEvent(Connection &connection, DWORD eventID, DWORD data) {
+  auto *event = static_cast<SIMCONNECT_RECV_EVENT *>(beginMessage(
+      connection, sizeof(SIMCONNECT_RECV_EVENT), SIMCONNECT_RECV_ID_EVENT));
+  event->uGroupID = SIMCONNECT_UNUSED;
+  event->uEventID = eventID;
+  event->dwData = data;
+}
+
+void queueFrame(const Sim &s, Connection &connection, DWORD eventID) {
+  auto *frame = static_cast<SIMCONNECT_RECV_EVENT_FRAME *>(
+      beginMessage(connection, sizeof(SIMCONNECT_RECV_EVENT_FRAME),
+                   SIMCONNECT_RECV_ID_EVENT_FRAME));
+  frame->uGroupID = SIMCONNECT_UNUSED;
+  frame->uEventID = eventID;
+  frame->dwData = 0;
+  frame->fFrameRate = static_cast<float>(s.frameRate);
+  frame->fSimSpeed = 1.0f;
+}
+
+void queueData(Connection &connection, DWORD id, const Request &request,
+               const std::vector<DWORD> &datumIDs,
+               const std::vector<const std::string *> &values) {
+  size_t payload = 0;
+  const bool tagged = request.flags & SIMCONNECT_DATA_REQUEST_FLAG_TAGGED;
+  for (const auto *value : values) {
+    payload += value->size() + (tagged ? sizeof(DWORD) : 0);
+  }
+  auto *data = static_cast<SIMCONNECT_RECV_SIMOBJECT_DATA *>(
+      beginMessage(connection, dataHeaderSize + payload, id));
+  data->dwRequestID = request.requestID;
+  data->dwObjectID =
+      id == SIMCONNECT_RECV_ID_CLIENT_DATA ? 0 : request.objectOrArea;
+  data->dwDefineID = request.defineID;
+  data->dwFlags = request.flags;
+  data->dwentrynumber = 1;
+  data->dwoutof = 1;
+  data->dwDefineCount = static_cast<DWORD>(values.size());
+
+  char *out = reinterpret_cast<char *>(&data->dwData);
+  for (size_t i = 0; i < values.size(); i++) {
+    if (tagged) {
+      std::memcpy(out, &datumIDs[i], sizeof(DWORD));
+      out += sizeof(DWORD);
+    }
+    std::memcpy(out, values[i]->data(), values[i]->size());
+    out += values[i]->size();
+  }
+}
+
+// Collects the datums of a request that have to go out now and queues them.
+// Returns false when the CHANGED flag filtered everything.
+bool sendRequest(Connection &connection, DWORD messageID, Request &request,
+                 const std::vector<std::string> &values,
+                 const std::vector<DWORD> &datumIDs,
+                 const std::vector<bool> &isFloat,
+                 const std::vector<bool> &isDouble,
+                 const std::vector<float> &epsilons) {
+  const bool onlyChanged =
+      request.flags & SIMCONNECT_DATA_REQUEST_FLAG_CHANGED;
+  const bool tagged = request.flags & SIMCONNECT_DATA_REQUEST_FLAG_TAGGED;
+  request.lastValues.resize(values.size());
+
+  std::vector<size_t> send;
+  bool anyChanged = !request.hasSent;
+  for (size_t i = 0; i < values.size(); i++) {
+    const bool datumChanged =
+        !request.hasSent || changed(request.lastValues[i], values[i],
+                                    isFloat[i], isDouble[i], epsilons[i]);
+    anyChanged |= datumChanged;
+    // Tagged requests only carry the datums that changed
+    if (!onlyChanged || !tagged || datumChanged) {
+      send.push_back(i);
+    }
+  }
+  if (onlyChanged && (!anyChanged || send.empty())) {
+    return false;
+  }
+
+  std::vector<DWORD> sendIDs;
+  std::vector<const std::string *> sendValues;
+  for (const size_t i : send) {
+    sendIDs.push_back(datumIDs[i]);
+    sendValues.push_back(&values[i]);
+    request.lastValues[i] = values[i];
+  }
+  queueData(connection, messageID, request, sendIDs, sendValues);
+  request.hasSent = true;
+  request.sent++;
+  return true;
+}
+
+// Works out whether a periodic request is due on this frame
+bool due(const Sim &s, Request &request, int64_t frame) {
+  if (request.period == SIMCONNECT_PERIOD_NEVER) {
+    return false;
+  }
+  if (request.period == SIMCONNECT_PERIOD_ONCE) {
+    return !request.hasSent;
+  }
+  if (frame < request.nextFrame) {
+    return false;
+  }
+  const int64_t periodFrames =
+      request.period == SIMCONNECT_PERIOD_SECOND ? framesPerSecond(s) : 1;
+  request.nextFrame = frame + periodFrames * (request.interval + 1);
+  return true;
+}
+
+bool limitReached(const Request &request) {
+  return request.limit > 0 && request.sent >= request.limit;
+}
+
+void serveDataRequest(const Sim &s, Connection &connection, Request &request,
+                      int64_t frame) {
+  if (limitReached(request) || !due(s, request, frame)) {
+    return;
+  }
+  const auto &definition = connection.definitions[request.defineID];
+  std::vector<std::string> values;
+  std::vector<DWORD> datumIDs;
+  std::vector<bool> isFloat;
+  std::vector<bool> isDouble;
+  std::vector<float> epsilons;
+  for (size_t i = 0; i < definition.size(); i++) {
+    const Datum &datum = definition[i];
+    values.push_back(encodeDatum(s, datum, frame));
+    datumIDs.push_back(datum.datumID == SIMCONNECT_UNUSED
+                           ? static_cast<DWORD>(i)
+                           : datum.datumID);
+    isFloat.push_back(datum.type == SIMCONNECT_DATATYPE_FLOAT32 ||
+                      datum.type == SIMCONNECT_DATATYPE_FLOAT64);
+    isDouble.push_back(datum.type == SIMCONNECT_DATATYPE_FLOAT64);
+    epsilons.push_back(datum.epsilon);
+  }
+  sendRequest(connection, SIMCONNECT_RECV_ID_SIMOBJECT_DATA, request, values,
+              datumIDs, isFloat, isDouble, epsilons);
+}
+
+ClientArea &clientArea(Sim &s, const std::string &name) {
+  ClientArea &area = s.clientAreas[name];
+  if (area.bytes.empty()) {
+    area.bytes.resize(SIMCONNECT_CLIENTDATA_MAX_SIZE);
+  }
+  return area;
+}
+
+void serveClientRequest(Sim &s, Connection &connection, Request &request,
+                        bool onSet) {
+  ClientArea &area =
+      clientArea(s, connection.clientAreaNames[request.objectOrArea]);
+  if (onSet) {
+    if (area.version == request.seenVersion) {
+      return;
+    }
+    request.seenVersion = area.version;
+  }
+  if (limitReached(request)) {
+    return;
+  }
+  const auto &definition = connection.clientDefinitions[request.defineID];
+  std::vector<std::string> values;
+  std::vector<DWORD> datumIDs;
+  std::vector<bool> isFloat;
+  std::vector<bool> isDouble;
+  std::vector<float> epsilons;
+  for (size_t i = 0; i < definition.size(); i++) {
+    const ClientDatum &datum = definition[i];
+    const size_t offset = std::min<size_t>(datum.offset, area.bytes.size());
+    const size_t size =
+        std::min<size_t>(datum.size, area.bytes.size() - offset);
+    values.emplace_back(area.bytes.data() + offset, size);
+    datumIDs.push_back(datum.datumID == SIMCONNECT_UNUSED
+                           ? static_cast<DWORD>(i)
+                           : datum.datumID);
+    isFloat.push_back(datum.isFloat);
+    isDouble.push_back(datum.isFloat && datum.size == sizeof(double));
+    epsilons.push_back(datum.epsilon);
+  }
+  sendRequest(connection, SIMCONNECT_RECV_ID_CLIENT_DATA, request, values,
+              datumIDs, isFloat, isDouble, epsilons);
+}
+
+// Fills the outbox of a connection with everything that happened since it
+// was last dispatched
+void advance(Sim &s, Connection &connection) {
+  if (!connection.opened) {
+    auto *open = static_cast<SIMCONNECT_RECV_OPEN *>(beginMessage(
+        connection, sizeof(SIMCONNECT_RECV_OPEN), SIMCONNECT_RECV_ID_OPEN));
+    std::memset(reinterpret_cast<char *>(open) + sizeof(SIMCONNECT_RECV), 0,
+                sizeof(SIMCONNECT_RECV_OPEN) - sizeof(SIMCONNECT_RECV));
+    std::strncpy(open->szApplicationName, "SimConnect stand-in",
+                 sizeof(open->szApplicationName) - 1);
+    connection.opened = true;
+  }
+
+  for (const auto &[eventID, name] : connection.subscriptions) {
+    if ((name == "SIMSTART" || name == "SIM") &&
+        connection.startSent.insert(eventID).second) {
+      queueEvent(connection, eventID, 1);
+    }
+  }
+
+  const int64_t now = currentFrame(s);
+  const int64_t oldest =
+      now - static_cast<int64_t>(s.frameRate * maxCatchUpSeconds);
+  const int perSecond = framesPerSecond(s);
+  for (int64_t frame = std::max(connection.frame + 1, oldest); frame <= now;
+       frame++) {
+    for (const auto &[eventID, name] : connection.subscriptions) {
+      if (name == "FRAME" || name == "SIMFRAME") {
+        queueFrame(s, connection, eventID);
+      } else if ((name == "1SEC" && frame % perSecond == 0) ||
+                 (name == "4SEC" && frame % (4 * perSecond) == 0) ||
+                 (name == "6HZ" && frame % std::max(1, perSecond / 6) == 0)) {
+        queueEvent(connection, eventID, 0);
+      }
+    }
+    for (auto &request : connection.requests) {
+      serveDataRequest(s, connection, request, frame);
+    }
+    for (auto &request : connection.clientRequests) {
+      if (request.period != SIMCONNECT_CLIENT_DATA_PERIOD_ON_SET &&
+          due(s, request, frame)) {
+        serveClientRequest(s, connection, request, false);
+      }
+    }
+  }
+  connection.frame = std::max(connection.frame, now);
+
+  for (auto &request : connection.clientRequests) {
+    if (request.period == SIMCONNECT_CLIENT_DATA_PERIOD_ON_SET) {
+      serveClientRequest(s, connection, request, true);
+    }
+  }
+
+  if (s.quitAfter > 0 && !connection.quit &&
+      nsSinceStart(s) - connection.openedNs >= s.quitAfter * 1e9) {
+    beginMessage(connection, sizeof(SIMCONNECT_RECV_QUIT),
+                 SIMCONNECT_RECV_ID_QUIT);
+    connection.quit = true;
+  }
+}
+
+void signalEvent(HANDLE event) {
+#ifdef _WIN32
+  SetEvent(event);
+#else
+  const uint64_t one = 1;
+  const ssize_t written =
+      write(static_cast<int>(reinterpret_cast<intptr_t>(event)), &one,
+            sizeof(one));
+  static_cast<void>(written);
+#endif
+}
+
+// Like the sim, only connections that have something coming are woken
+bool expectsMessages(const Sim &s, const Connection &connection) {
+  return !connection.opened || !connection.subscriptions.empty() ||
+         !connection.requests.empty() || !connection.clientRequests.empty() ||
+         (s.quitAfter > 0 && !connection.quit);
+}
+
+void tick(Sim &s) {
+  std::unique_lock<std::mutex> lock(s.mutex);
+  int64_t frame = currentFrame(s);
+  while (!s.stopTicker) {
+    const std::chrono::duration<double> untilNext(
+        (frame + 1 - s.frameBase) / s.frameRate);
+    s.tickerWake.wait_until(
+        lock, s.frameBaseTime +
+                  std::chrono::duration_cast<Clock::duration>(untilNext));
+    const int64_t now = currentFrame(s);
+    if (now == frame) {
+      continue;
+    }
+    frame = now;
+    for (const auto *connection : s.connections) {
+      if (connection->event != nullptr && expectsMessages(s, *connection)) {
+        signalEvent(connection->event);
+      }
+    }
+  }
+}
+
+void recordEvent(Sim &s, TransmittedEvent event) {
+  event.timestampNs = nsSinceStart(s);
+  s.events.push_back(std::move(event));
+  s.eventRecorded.notify_all();
+}
+
+bool writeEvents(const std::string &path,
+                 const std::vector<TransmittedEvent> &events) {
+  std::ofstream file(path);
+  if (!file) {
+    return false;
+  }
+  file << "timestamp_ns,connection,event_id,name,data,payload\n";
+  for (const auto &event : events) {
+    std::string payload = event.payload;
+    std::replace(payload.begin(), payload.end(), '"', '\'');
+    file << event.timestampNs << ',' << event.connection << ','
+         << event.eventID << ',' << event.name << ',' << event.data << ",\""
+         << payload << "\"\n";
+  }
+  return true;
+}
+
+Sim::~Sim() {
+  if (ticker.joinable()) {
+    {
+      std::lock_guard<std::mutex> lock(mutex);
+      stopTicker = true;
+    }
+    tickerWake.notify_all();
+    ticker.join();
+  }
+  if (!recordPath.empty() && !writeEvents(recordPath, events)) {
+    std::cerr << "simconnect stand-in: could not write " << recordPath
+              << std::endl;
+  }
+}
+
+// Looks up a handle handed out by SimConnect_Open. The caller holds the lock.
+Connection *find(Sim &s, HANDLE handle) {
+  auto *connection = static_cast<Connection *>(handle);
+  if (s.connections.count(connection) == 0 || connection->quit) {
+    return nullptr;
+  }
+  return connection;
+}
+
+void setVariableLocked(Sim &s, const std::string &name, double value,
+                       double step, double min, double max) {
+  Variable &variable = s.variables[normalize(name)];
+  variable.value = value;
+  variable.step = step;
+  variable.min = min;
+  variable.max = max;
+  variable.frame = currentFrame(s);
+}
+
+void writeClientDataLocked(Sim &s, const std::string &name, DWORD offset,
+                           const void *data, DWORD size) {
+  ClientArea &area = clientArea(s, name);
+  if (offset >= area.bytes.size()) {
+    return;
+  }
+  size = std::min<DWORD>(size, area.bytes.size() - offset);
+  std::memcpy(area.bytes.data() + offset, data, size);
+  area.version++;
+  // ON_SET requests are due right away, not on the next frame
+  for (const auto *connection : s.connections) {
+    if (connection->event != nullptr && !connection->clientRequests.empty()) {
+      signalEvent(connection->event);
+    }
+  }
+}
+
+void loadScriptOnce() {
+  Sim &s = sim();
+  {
+    std::lock_guard<std::mutex> lock(s.mutex);
+    if (s.scriptLoaded) {
+      return;
+    }
+    s.scriptLoaded = true;
+  }
+  if (const char *path = std::getenv("SIMCONNECT_STANDIN_SCRIPT")) {
+    if (!simconnectstandin::loadScript(path)) {
+      std::cerr << "simconnect stand-in: could not read " << path
+                << std::endl;
+    }
+  }
+}
+
+}  // namespace
+
+namespace simconnectstandin {
+
+bool loadScript(const std::string &path) {
+  std::ifstream file(path);
+  if (!file) {
+    return false;
+  }
+  std::stringstream text;
+  text << file.rdbuf();
+  runScript(text.str());
+  return true;
+}
+
+void runScript(const std::string &text) {
+  std::istringstream lines(text);
+  std::string line;
+  while (std::getline(lines, line)) {
+    const auto comment = line.find('#');
+    if (comment != std::string::npos) {
+      line.erase(comment);
+    }
+    std::istringstream words(line);
+    std::string command;
+    if (!(words >> command)) {
+      continue;
+    }
+
+    // Sim variable names contain spaces, so they run up to the '='
+    std::string name;
+    std::istringstream values;
+    const auto equals = line.find('=');
+    if (equals != std::string::npos) {
+      const auto start = line.find(command) + command.size();
+      name = line.substr(start, equals - start);
+      values.str(line.substr(equals + 1));
+    }
+
+    bool ok = true;
+    if (command == "frame_rate") {
+      double rate = 0;
+      ok = static_cast<bool>(words >> rate) && rate > 0;
+      if (ok) {
+        setFrameRate(rate);
+      }
+    } else if (command == "var" && !normalize(name).empty()) {
+      double value = 0, step = 0, min = 0, max = 0;
+      ok = static_cast<bool>(values >> value);
+      values >> step >> min >> max;
+      if (ok) {
+        setVariable(name, value, step, min, max);
+      }
+    } else if (command == "string" && !normalize(name).empty()) {
+      std::string value = line.substr(equals + 1);
+      const auto first = value.find_first_not_of(" \t");
+      const auto last = value.find_last_not_of(" \t\r");
+      setString(name, first == std::string::npos
+                          ? std::string()
+                          : value.substr(first, last - first + 1));
+    } else if (command == "client_data" && equals != std::string::npos) {
+      std::istringstream target(name);
+      std::string area;
+      DWORD offset = 0;
+      float value = 0;
+      ok = static_cast<bool>(target >> area >> offset) &&
+           static_cast<bool>(values >> value);
+      if (ok) {
+        writeClientData(area, offset, &value, sizeof(value));
+      }
+    } else if (command == "refuse_open") {
+      int count = 0;
+      ok = static_cast<bool>(words >> count);
+      refuseOpens(count);
+    } else if (command == "quit_after") {
+      double seconds = 0;
+      ok = static_cast<bool>(words >> seconds);
+      quitAfter(seconds);
+    } else if (command == "record") {
+      std::string path;
+      ok = static_cast<bool>(words >> path);
+      std::lock_guard<std::mutex> lock(sim().mutex);
+      sim().recordPath = path;
+    } else {
+      ok = false;
+    }
+    if (!ok) {
+      std::cerr << "simconnect stand-in: skipped script line: " << line
+                << std::endl;
+    }
+  }
+}
+
+void setFrameRate(double framesPerSecond) {
+  Sim &s = sim();
+  std::lock_guard<std::mutex> lock(s.mutex);
+  s.frameBase = currentFrame(s);
+  s.frameBaseTime = Clock::now();
+  s.frameRate = framesPerSecond;
+  s.tickerWake.notify_all();
+}
+
+void setVariable(const std::string &name, double value, double step,
+                 double min, double max) {
+  Sim &s = sim();
+  std::lock_guard<std::mutex> lock(s.mutex);
+  setVariableLocked(s, name, value, step, min, max);
+}
+
+void setString(const std::string &name, const std::string &value) {
+  Sim &s = sim();
+  std::lock_guard<std::mutex> lock(s.mutex);
+  s.variables[normalize(name)].text = value;
+}
+
+double variable(const std::string &name) {
+  Sim &s = sim();
+  std::lock_guard<std::mutex> lock(s.mutex);
+  const auto found = s.variables.find(normalize(name));
+  return found == s.variables.end() ? 0
+                                    : valueAt(found->second, currentFrame(s));
+}
+
+void writeClientData(const std::string &area, DWORD offset, const void *data,
+                     DWORD size) {
+  Sim &s = sim();
+  std::lock_guard<std::mutex> lock(s.mutex);
+  writeClientDataLocked(s, area, offset, data, size);
+}
+
+void refuseOpens(int count) {
+  Sim &s = sim();
+  std::lock_guard<std::mutex> lock(s.mutex);
+  s.refuseOpens = count;
+}
+
+void quitAfter(double seconds) {
+  Sim &s = sim();
+  std::lock_guard<std::mutex> lock(s.mutex);
+  s.quitAfter = seconds;
+}
+
+int64_t nowNs() { return nsSinceStart(sim()); }
+
+std::vector<TransmittedEvent> transmittedEvents() {
+  Sim &s = sim();
+  std::lock_guard<std::mutex> lock(s.mutex);
+  return s.events;
+}
+
+size_t transmittedEventCount() {
+  Sim &s = sim();
+  std::lock_guard<std::mutex> lock(s.mutex);
+  return s.events.size();
+}
+
+size_t waitForTransmittedEvents(size_t count,
+                                std::chrono::milliseconds timeout) {
+  Sim &s = sim();
+  std::unique_lock<std::mutex> lock(s.mutex);
+  s.eventRecorded.wait_for(lock, timeout,
+                           [&s, count] { return s.events.size() >= count; });
+  return s.events.size();
+}
+
+void clearTransmittedEvents() {
+  Sim &s = sim();
+  std::lock_guard<std::mutex> lock(s.mutex);
+  s.events.clear();
+}
+
+bool writeRecording(const std::string &path) {
+  return writeEvents(path, transmittedEvents());
+}
+
+}  // namespace simconnectstandin
+
+SIMCONNECTAPI SimConnect_Open(HANDLE *phSimConnect, LPCSTR szName,
+                              HWND /*hWnd*/, DWORD /*UserEventWin32*/,
+                              HANDLE hEventHandle, DWORD /*ConfigIndex*/) {
+  loadScriptOnce();
+  Sim &s = sim();
+  std::lock_guard<std::mutex> lock(s.mutex);
+  if (s.refuseOpens > 0) {
+    s.refuseOpens--;
+    return E_FAIL;
+  }
+  auto *connection = new Connection;
+  connection->name = szName ? szName : "";
+  connection->event = hEventHandle;
+  connection->openedNs = nsSinceStart(s);
+  connection->frame = currentFrame(s);
+  s.connections.insert(connection);
+  if (hEventHandle != nullptr) {
+    // The OPEN message is waiting already
+    signalEvent(hEventHandle);
+    if (!s.ticker.joinable()) {
+      s.ticker = std::thread(tick, std::ref(s));
+    }
+  }
+  *phSimConnect = connection;
+  return S_OK;
+}
+
+SIMCONNECTAPI SimConnect_Close(HANDLE hSimConnect) {
+  Sim &s = sim();
+  std::lock_guard<std::mutex> lock(s.mutex);
+  auto *connection = static_cast<Connection *>(hSimConnect);
+  if (s.connections.erase(connection) == 0) {
+    return E_FAIL;
+  }
+  delete connection;
+  return S_OK;
+}
+
+SIMCONNECTAPI SimConnect_CallDispatch(HANDLE hSimConnect,
+                                      DispatchProc pfcnDispatch,
+                                      void *pContext) {
+  Sim &s = sim();
+  std::vector<char> outbox;
+  std::vector<size_t> offsets;
+  {
+    std::lock_guard<std::mutex> lock(s.mutex);
+    Connection *connection = find(s, hSimConnect);
+    if (connection == nullptr) {
+      return E_FAIL;
+    }
+    advance(s, *connection);
+    outbox.swap(connection->outbox);
+    offsets.swap(connection->offsets);
+  }
+
+  // The dispatch proc is free to call back into SimConnect, so it runs
+  // without the lock
+  for (const size_t offset : offsets) {
+    auto *message = reinterpret_cast<SIMCONNECT_RECV *>(outbox.data() + offset);
+    pfcnDispatch(message, message->dwSize, pContext);
+  }
+
+  // Hand the buffers back so the next dispatch doesn't allocate
+  std::lock_guard<std::mutex> lock(s.mutex);
+  auto *connection = static_cast<Connection *>(hSimConnect);
+  if (s.connections.count(connection) && connection->outbox.empty()) {
+    outbox.clear();
+    offsets.clear();
+    connection->outbox.swap(outbox);
+    connection->offsets.swap(offsets);
+  }
+  return S_OK;
+}
+
+SIMCONNECTAPI SimConnect_GetLastSentPacketID(HANDLE hSimConnect,
+                                             DWORD *pdwError) {
+  Sim &s = sim();
+  std::lock_guard<std::mutex> lock(s.mutex);
+  *pdwError = s.packetID;
+  return find(s, hSimConnect) ? S_OK : E_FAIL;
+}
+
+SIMCONNECTAPI SimConnect_MapClientEventToSimEvent(
+    HANDLE hSimConnect, SIMCONNECT_CLIENT_EVENT_ID EventID,
+    const char *EventName) {
+  Sim &s = sim();
+  std::lock_guard<std::mutex> lock(s.mutex);
+  Connection *connection = find(s, hSimConnect);
+  if (connection == nullptr) {
+    return E_FAIL;
+  }
+  s.packetID++;
+  connection->eventNames[EventID] = EventName ? EventName : "";
+  return S_OK;
+}
+
+SIMCONNECTAPI SimConnect_TransmitClientEvent(
+    HANDLE hSimConnect, SIMCONNECT_OBJECT_ID /*ObjectID*/,
+    SIMCONNECT_CLIENT_EVENT_ID EventID, DWORD dwData,
+    SIMCONNECT_NOTIFICATION_GROUP_ID /*GroupID*/,
+    SIMCONNECT_EVENT_FLAG /*Flags*/) {
+  Sim &s = sim();
+  std::lock_guard<std::mutex> lock(s.mutex);
+  Connection *connection = find(s, hSimConnect);
+  if (connection == nullptr) {
+    return E_FAIL;
+  }
+  s.packetID++;
+  TransmittedEvent event;
+  event.connection = connection->name;
+  event.eventID = EventID;
+  event.name = connection->eventNames[EventID];
+  event.data = dwData;
+  recordEvent(s, std::move(event));
+  return S_OK;
+}
+
+SIMCONNECTAPI SimConnect_AddClientEventToNotificationGroup(
+    HANDLE hSimConnect, SIMCONNECT_NOTIFICATION_GROUP_ID /*GroupID*/,
+    SIMCONNECT_CLIENT_EVENT_ID /*EventID*/, BOOL /*bMaskable*/) {
+  Sim &s = sim();
+  std::lock_guard<std::mutex> lock(s.mutex);
+  return find(s, hSimConnect) ? S_OK : E_FAIL;
+}
+
+SIMCONNECTAPI SimConnect_SetNotificationGroupPriority(
+    HANDLE hSimConnect, SIMCONNECT_NOTIFICATION_GROUP_ID /*GroupID*/,
+    DWORD /*uPriority*/) {
+  Sim &s = sim();
+  std::lock_guard<std::mutex> lock(s.mutex);
+  return find(s, hSimConnect) ? S_OK : E_FAIL;
+}
+
+SIMCONNECTAPI SimConnect_AddToDataDefinition(
+    HANDLE hSimConnect, SIMCONNECT_DATA_DEFINITION_ID DefineID,
+    const char *DatumName, const char * /*UnitsName*/,
+    SIMCONNECT_DATATYPE DatumType, float fEpsilon, DWORD DatumID) {
+  Sim &s = sim();
+  std::lock_guard<std::mutex> lock(s.mutex);
+  Connection *connection = find(s, hSimConnect);
+  if (connection == nullptr || datumSize(DatumType) == 0) {
+    return E_FAIL;
+  }
+  s.packetID++;
+  connection->definitions[DefineID].push_back(
+      {normalize(DatumName ? DatumName : ""), DatumType, fEpsilon, DatumID});
+  return S_OK;
+}
+
+SIMCONNECTAPI SimConnect_ClearDataDefinition(
+    HANDLE hSimConnect, SIMCONNECT_DATA_DEFINITION_ID DefineID) {
+  Sim &s = sim();
+  std::lock_guard<std::mutex> lock(s.mutex);
+  Connection *connection = find(s, hSimConnect);
+  if (connection == nullptr) {
+    return E_FAIL;
+  }
+  connection->definitions.erase(DefineID);
+  return S_OK;
+}
+
+SIMCONNECTAPI SimConnect_RequestDataOnSimObject(
+    HANDLE hSimConnect, SIMCONNECT_DATA_REQUEST_ID RequestID,
+    SIMCONNECT_DATA_DEFINITION_ID DefineID, SIMCONNECT_OBJECT_ID ObjectID,
+    SIMCONNECT_PERIOD Period, SIMCONNECT_DATA_REQUEST_FLAG Flags, DWORD origin,
+    DWORD interval, DWORD limit) {
+  Sim &s = sim();
+  std::lock_guard<std::mutex> lock(s.mutex);
+  Connection *connection = find(s, hSimConnect);
+  if (connection == nullptr) {
+    return E_FAIL;
+  }
+  s.packetID++;
+  auto &requests = connection->requests;
+  requests.erase(std::remove_if(requests.begin(), requests.end(),
+                                [RequestID](const Request &request) {
+                                  return request.requestID == RequestID;
+                                }),
+                 requests.end());
+  if (Period == SIMCONNECT_PERIOD_NEVER) {
+    return S_OK;
+  }
+  Request request;
+  request.requestID = RequestID;
+  request.defineID = DefineID;
+  request.objectOrArea = ObjectID;
+  request.period = Period;
+  request.flags = Flags;
+  request.interval = interval;
+  request.limit = limit;
+  request.nextFrame = connection->frame + 1 + origin;
+  requests.push_back(std::move(request));
+  return S_OK;
+}
+
+SIMCONNECTAPI SimConnect_SubscribeToSystemEvent(
+    HANDLE hSimConnect, SIMCONNECT_CLIENT_EVENT_ID EventID,
+    const char *SystemEventName) {
+  Sim &s = sim();
+  std::lock_guard<std::mutex> lock(s.mutex);
+  Connection *connection = find(s, hSimConnect);
+  if (connection == nullptr) {
+    return E_FAIL;
+  }
+  s.packetID++;
+  connection->subscriptions[EventID] =
+      normalize(SystemEventName ? SystemEventName : "");
+  return S_OK;
+}
+
+SIMCONNECTAPI SimConnect_UnsubscribeFromSystemEvent(
+    HANDLE hSimConnect, SIMCONNECT_CLIENT_EVENT_ID EventID) {
+  Sim &s = sim();
+  std::lock_guard<std::mutex> lock(s.mutex);
+  Connection *connection = find(s, hSimConnect);
+  if (connection == nullptr) {
+    return E_FAIL;
+  }
+  connection->subscriptions.erase(EventID);
+  connection->startSent.erase(EventID);
+  return S_OK;
+}
+
+SIMCONNECTAPI SimConnect_MapClientDataNameToID(
+    HANDLE hSimConnect, const char *szClientDataName,
+    SIMCONNECT_CLIENT_DATA_ID ClientDataID) {
+  Sim &s = sim();
+  std::lock_guard<std::mutex> lock(s.mutex);
+  Connection *connection = find(s, hSimConnect);
+  if (connection == nullptr) {
+    return E_FAIL;
+  }
+  s.packetID++;
+  connection->clientAreaNames[ClientDataID] =
+      szClientDataName ? szClientDataName : "";
+  return S_OK;
+}
+
+SIMCONNECTAPI SimConnect_CreateClientData(
+    HANDLE hSimConnect, SIMCONNECT_CLIENT_DATA_ID ClientDataID, DWORD dwSize,
+    SIMCONNECT_CREATE_CLIENT_DATA_FLAG /*Flags*/) {
+  Sim &s = sim();
+  std::lock_guard<std::mutex> lock(s.mutex);
+  Connection *connection = find(s, hSimConnect);
+  if (connection == nullptr || dwSize > SIMCONNECT_CLIENTDATA_MAX_SIZE) {
+    return E_FAIL;
+  }
+  s.packetID++;
+  // Every area gets the maximum size, a second create of the same name is
+  // accepted like the WASM module and the connector expect
+  clientArea(s, connection->clientAreaNames[ClientDataID]);
+  return S_OK;
+}
+
+SIMCONNECTAPI SimConnect_AddToClientDataDefinition(
+    HANDLE hSimConnect, SIMCONNECT_CLIENT_DATA_DEFINITION_ID DefineID,
+    DWORD dwOffset, DWORD dwSizeOrType, float fEpsilon, DWORD DatumID) {
+  Sim &s = sim();
+  std::lock_guard<std::mutex> lock(s.mutex);
+  Connection *connection = find(s, hSimConnect);
+  if (connection == nullptr) {
+    return E_FAIL;
+  }
+  s.packetID++;
+  ClientDatum datum{dwOffset, dwSizeOrType, false, fEpsilon, DatumID};
+  if (dwSizeOrType == SIMCONNECT_CLIENTDATATYPE_INT8) {
+    datum.size = 1;
+  } else if (dwSizeOrType == SIMCONNECT_CLIENTDATATYPE_INT16) {
+    datum.size = 2;
+  } else if (dwSizeOrType == SIMCONNECT_CLIENTDATATYPE_INT32) {
+    datum.size = 4;
+  } else if (dwSizeOrType == SIMCONNECT_CLIENTDATATYPE_INT64) {
+    datum.size = 8;
+  } else if (dwSizeOrType == SIMCONNECT_CLIENTDATATYPE_FLOAT32) {
+    datum.size = 4;
+    datum.isFloat = true;
+  } else if (dwSizeOrType == SIMCONNECT_CLIENTDATATYPE_FLOAT64) {
+    datum.size = 8;
+    datum.isFloat = true;
+  }
+  if (datum.size > SIMCONNECT_CLIENTDATA_MAX_SIZE) {
+    return E_FAIL;
+  }
+  auto &definition = connection->clientDefinitions[DefineID];
+  if (dwOffset == SIMCONNECT_CLIENTDATAOFFSET_AUTO) {
+    datum.offset = definition.empty()
+                       ? 0
+                       : definition.back().offset + definition.back().size;
+  }
+  definition.push_back(datum);
+  return S_OK;
+}
+
+SIMCONNECTAPI SimConnect_ClearClientDataDefinition(
+    HANDLE hSimConnect, SIMCONNECT_CLIENT_DATA_DEFINITION_ID DefineID) {
+  Sim &s = sim();
+  std::lock_guard<std::mutex> lock(s.mutex);
+  Connection *connection = find(s, hSimConnect);
+  if (connection == nullptr) {
+    return E_FAIL;
+  }
+  connection->clientDefinitions.erase(DefineID);
+  return S_OK;
+}
+
+SIMCONNECTAPI SimConnect_RequestClientData(
+    HANDLE hSimConnect, SIMCONNECT_CLIENT_DATA_ID ClientDataID,
+    SIMCONNECT_DATA_REQUEST_ID RequestID,
+    SIMCONNECT_CLIENT_DATA_DEFINITION_ID DefineID,
+    SIMCONNECT_CLIENT_DATA_PERIOD Period,
+    SIMCONNECT_CLIENT_DATA_REQUEST_FLAG Flags, DWORD origin, DWORD interval,
+    DWORD limit) {
+  Sim &s = sim();
+  std::lock_guard<std::mutex> lock(s.mutex);
+  Connection *connection = find(s, hSimConnect);
+  if (connection == nullptr) {
+    return E_FAIL;
+  }
+  s.packetID++;
+  // The connector reuses one request ID for several definitions, so a
+  // request is identified by both
+  auto &requests = connection->clientRequests;
+  requests.erase(std::remove_if(requests.begin(), requests.end(),
+                                [RequestID, DefineID](const Request &request) {
+                                  return request.requestID == RequestID &&
+                                         request.defineID == DefineID;
+                                }),
+                 requests.end());
+  if (Period == SIMCONNECT_CLIENT_DATA_PERIOD_NEVER) {
+    return S_OK;
+  }
+
+  // Map the client data periods onto the SIMCONNECT_PERIOD values due()
+  // understands, ON_SET requests are served outside the frame loop
+  int period = SIMCONNECT_PERIOD_VISUAL_FRAME;
+  if (Period == SIMCONNECT_CLIENT_DATA_PERIOD_ONCE) {
+    period = SIMCONNECT_PERIOD_ONCE;
+  } else if (Period == SIMCONNECT_CLIENT_DATA_PERIOD_SECOND) {
+    period = SIMCONNECT_PERIOD_SECOND;
+  } else if (Period == SIMCONNECT_CLIENT_DATA_PERIOD_ON_SET) {
+    period = SIMCONNECT_CLIENT_DATA_PERIOD_ON_SET;
+  }
+
+  Request request;
+  request.requestID = RequestID;
+  request.defineID = DefineID;
+  request.objectOrArea = ClientDataID;
+  request.period = period;
+  request.flags = Flags;
+  request.interval = interval;
+  request.limit = limit;
+  request.nextFrame = connection->frame + 1 + origin;
+  request.seenVersion =
+      clientArea(s, connection->clientAreaNames[ClientDataID]).version;
+  requests.push_back(std::move(request));
+  return S_OK;
+}
+
+SIMCONNECTAPI SimConnect_SetClientData(
+    HANDLE hSimConnect, SIMCONNECT_CLIENT_DATA_ID ClientDataID,
+    SIMCONNECT_CLIENT_DATA_DEFINITION_ID DefineID,
+    SIMCONNECT_CLIENT_DATA_SET_FLAG /*Flags*/, DWORD /*dwReserved*/,
+    DWORD cbUnitSize, void *pDataSet) {
+  Sim &s = sim();
+  std::lock_guard<std::mutex> lock(s.mutex);
+  Connection *connection = find(s, hSimConnect);
+  if (connection == nullptr || pDataSet == nullptr) {
+    return E_FAIL;
+  }
+  s.packetID++;
+  const std::string &area = connection->clientAreaNames[ClientDataID];
+  const auto &definition = connection->clientDefinitions[DefineID];
+  const DWORD offset = definition.empty() ? 0 : definition.front().offset;
+  writeClientDataLocked(s, area, offset, pDataSet, cbUnitSize);
+
+  const auto *bytes = static_cast<const char *>(pDataSet);
+  TransmittedEvent event;
+  event.connection = connection->name;
+  event.eventID = SIMCONNECT_UNUSED;
+  event.name = "client:" + area;
+  event.data = cbUnitSize;
+  event.payload.assign(bytes, strnlen(bytes, cbUnitSize));
+  recordEvent(s, std::move(event));
+  return S_OK;
+}
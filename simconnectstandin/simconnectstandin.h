@@ -0,0 +1,68 @@
+#ifndef SIMCONNECTSTANDIN_H
+#define SIMCONNECTSTANDIN_H
+
+#include <headers/SimConnect.h>
+
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+// Control side of the SimConnect stand-in. The SimConnect_* functions in
+// simconnectstandin.cpp behave like a sim that runs at a fixed frame rate;
+// these functions let a benchmark or a script decide what that sim reports
+// and read back what the connector sent to it.
+namespace simconnectstandin {
+
+// One TransmitClientEvent or SetClientData call as seen by the sim
+struct TransmittedEvent {
+  // Nanoseconds since the stand-in was first used, steady clock
+  int64_t timestampNs = 0;
+  // The name the connection was opened with
+  std::string connection;
+  DWORD eventID = 0;
+  // The sim event the ID was mapped to, or "client:<area>" for client data
+  std::string name;
+  DWORD data = 0;
+  // Text written with SetClientData, empty for events
+  std::string payload;
+};
+
+// Reads a script file, see README.md for the commands. Returns false when
+// the file can't be opened, unknown lines are reported and skipped.
+bool loadScript(const std::string &path);
+void runScript(const std::string &text);
+
+void setFrameRate(double framesPerSecond);
+
+// A sim variable that starts at value and moves step per frame, wrapping
+// from max back to min when max > min. Names are case insensitive and the
+// units are ignored.
+void setVariable(const std::string &name, double value, double step = 0,
+                 double min = 0, double max = 0);
+void setString(const std::string &name, const std::string &value);
+double variable(const std::string &name);
+
+// Writes into a named client data area as the WASM module would
+void writeClientData(const std::string &area, DWORD offset, const void *data,
+                     DWORD size);
+
+// The next count calls to SimConnect_Open fail as if the sim isn't running
+void refuseOpens(int count);
+// Every connection gets a QUIT message this many seconds after it opened
+void quitAfter(double seconds);
+
+int64_t nowNs();
+std::vector<TransmittedEvent> transmittedEvents();
+size_t transmittedEventCount();
+// Blocks until at least count events were recorded or the timeout passed
+size_t waitForTransmittedEvents(size_t count,
+                                std::chrono::milliseconds timeout);
+void clearTransmittedEvents();
+// Writes the recorded events as CSV
+bool writeRecording(const std::string &path);
+
+}  // namespace simconnectstandin
+
+#endif  // SIMCONNECTSTANDIN_H
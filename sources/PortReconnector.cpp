@@ -0,0 +1,79 @@
+#include "headers/PortReconnector.h"
+
+#include <headers/constants.h>
+
+#include <algorithm>
+#include <iostream>
+
+void PortReconnector::watch(const std::vector<SerialPort *> &ports) {
+  watched.clear();
+  lostPorts = 0;
+  // Ports that never opened are retried right away on the first poll
+  const auto now = Clock::now();
+  for (auto *port : ports) {
+    const bool healthy = port->isConnected();
+    watched.push_back(
+        {port, healthy ? HEALTHY : LOST, constants::portReconnectMinMs, now});
+    if (!healthy) {
+      lostPorts++;
+    }
+  }
+  nextCheck = now;
+}
+
+const std::vector<int> &PortReconnector::poll() {
+  reconnected.clear();
+  lostNow.clear();
+  stateChanged = false;
+  const auto now = Clock::now();
+  if (now < nextCheck) {
+    return reconnected;
+  }
+  nextCheck = now + std::chrono::milliseconds(constants::portHealthCheckMs);
+
+  for (size_t i = 0; i < watched.size(); i++) {
+    WatchedPort &entry = watched[i];
+    switch (entry.state) {
+      case HEALTHY:
+        if (!entry.port->pollConnection()) {
+          std::cout << "Board " << i << " disconnected" << std::endl;
+          entry.state = LOST;
+          entry.backoffMs = constants::portReconnectMinMs;
+          entry.due = now + std::chrono::milliseconds(entry.backoffMs);
+          lostPorts++;
+          stateChanged = true;
+          lostNow.push_back(static_cast<int>(i));
+        }
+        break;
+      case LOST:
+        if (now < entry.due) {
+          break;
+        }
+        if (entry.port->reopen()) {
+          // The board resets when its port opens, give it the same settle
+          // time as at start before anything is sent
+          entry.state = SETTLING;
+          entry.due =
+              now + std::chrono::milliseconds(entry.port->settleTimeMs());
+        } else {
+          entry.backoffMs =
+              std::min(entry.backoffMs * 2, constants::portReconnectMaxMs);
+          entry.due = now + std::chrono::milliseconds(entry.backoffMs);
+        }
+        break;
+      case SETTLING:
+        if (!entry.port->pollConnection()) {
+          entry.state = LOST;
+          entry.due = now + std::chrono::milliseconds(entry.backoffMs);
+        } else if (now >= entry.due) {
+          std::cout << "Board " << i << " reconnected" << std::endl;
+          entry.state = HEALTHY;
+          lostPorts--;
+          stateChanged = true;
+          reconnected.push_back(static_cast<int>(i));
+        }
+        break;
+    }
+  }
+  return reconnected;
+}
@@ -0,0 +1,64 @@
+#include "headers/SerialLineFramer.h"
+
+#include <cstring>
+
+char *SerialLineFramer::prepareWrite(size_t *available) {
+  // Move a partial line to the front so lines are always contiguous
+  if (start > 0) {
+    std::memmove(buffer, buffer + start, end - start);
+    scanned -= start;
+    end -= start;
+    start = 0;
+  }
+  // A full buffer without a line ending can never become a valid line
+  if (end == bufferSize) {
+    dropped += end;
+    start = scanned = end = 0;
+    discarding = true;
+  }
+  *available = bufferSize - end;
+  return buffer + end;
+}
+
+void SerialLineFramer::commitWrite(size_t written) {
+  if (written > bufferSize - end) {
+    written = bufferSize - end;
+  }
+  end += written;
+}
+
+bool SerialLineFramer::nextLine(std::string_view *line) {
+  while (scanned < end) {
+    const auto *found = static_cast<const char *>(
+        std::memchr(buffer + scanned, '\n', end - scanned));
+    if (found == nullptr) {
+      scanned = end;
+      return false;
+    }
+
+    size_t lineStart = start;
+    size_t lineEnd = found - buffer;
+    start = scanned = lineEnd + 1;
+
+    if (discarding) {
+      dropped += lineEnd - lineStart + 1;
+      discarding = false;
+      continue;
+    }
+    if (lineEnd > lineStart && buffer[lineEnd - 1] == '\r') {
+      lineEnd--;
+    }
+    if (lineEnd == lineStart) {
+      continue;
+    }
+    *line = std::string_view(buffer + lineStart, lineEnd - lineStart);
+    return true;
+  }
+  return false;
+}
+
+void SerialLineFramer::reset() {
+  start = scanned = end = 0;
+  discarding = false;
+  dropped = 0;
+}
@@ -8,30 +8,37 @@
 #include "headers/SerialPort.hpp"
 
 
-#include <qstandardpaths.h>
-#include <qstring.h>
-
-#include <chrono>
 #include <iostream>
-#include <thread>
 
-COMMTIMEOUTS cto;
+// Reading queued bytes into the line framer of this port;
+// complete lines can be taken with readLine afterwards
+int SerialPort::fillLineFramer() {
+  size_t available;
+  char *buffer = lineFramer.prepareWrite(&available);
+  int bytesRead = readSerialPort(buffer, available);
+  lineFramer.commitWrite(bytesRead);
+  return bytesRead;
+}
+
+#ifdef _WIN32
 
-SerialPort::SerialPort(const char *portName) {
+SerialPort::SerialPort(const char *portName) : portName(portName) {
   std::cout << portName << std::endl;
+  readOverlapped.hEvent = CreateEvent(NULL, TRUE, FALSE, NULL);
+  writeOverlapped.hEvent = CreateEvent(NULL, TRUE, FALSE, NULL);
+  waitOverlapped.hEvent = CreateEvent(NULL, TRUE, FALSE, NULL);
+  openPort();
+}
+
+void SerialPort::openPort() {
   this->connected = false;
+  this->waitPending = false;
 
-  this->handler =
-      CreateFileA(static_cast<LPCSTR>(portName), GENERIC_READ | GENERIC_WRITE,
-                  0, NULL, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, NULL);
+  this->handler = CreateFileA(
+      static_cast<LPCSTR>(portName.c_str()), GENERIC_READ | GENERIC_WRITE, 0,
+      NULL, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL | FILE_FLAG_OVERLAPPED, NULL);
 
-  arduinoWaitTime =
-      settingsHandler.retrieveSetting("com", "waitXMsBeforeSendingLineEdit")
-          ->toInt();
-  if (settingsHandler.retrieveSetting("com", "waitXMsBeforeSendingLineEdit")
-          ->isNull()) {
-    arduinoWaitTime = 15;
-  }
+  loadSettings();
 
   if (this->handler == INVALID_HANDLE_VALUE) {
     if (GetLastError() == ERROR_FILE_NOT_FOUND) {
@@ -46,12 +53,7 @@ SerialPort::SerialPort(const char *portName) {
     if (!GetCommState(this->handler, &dcbSerialParameters)) {
       std::cerr << "Failed to get current serial parameters\n";
     } else {
-      if (settingsHandler.retrieveSetting("com", "CBR")->isNull()) {
-        dcbSerialParameters.BaudRate = CBR_115200;
-      } else {
-        dcbSerialParameters.BaudRate =
-            settingsHandler.retrieveSetting("com", "CBR")->toInt();
-      }
+      dcbSerialParameters.BaudRate = baudRate;
       std::cout << "DCB" << dcbSerialParameters.BaudRate << std::endl;
 
       dcbSerialParameters.ByteSize = 8;
@@ -63,46 +65,41 @@ SerialPort::SerialPort(const char *portName) {
         std::cout << "ALERT: could not set serial port parameters\n";
       } else {
         this->connected = true;
+        // Reads return whatever is queued right away, so they don't need a
+        // ClearCommError first to find out how much there is
+        COMMTIMEOUTS timeouts = {};
+        timeouts.ReadIntervalTimeout = MAXDWORD;
+        SetCommTimeouts(this->handler, &timeouts);
+        SetCommMask(this->handler, EV_RXCHAR);
         PurgeComm(this->handler, PURGE_RXCLEAR | PURGE_TXCLEAR);
-        std::this_thread::sleep_for(std::chrono::milliseconds(arduinoWaitTime));
-        // Sleep(arduinoWaitTime);
       }
     }
   }
 }
 
 SerialPort::~SerialPort() {
-  if (this->connected) {
-    this->connected = false;
-    CloseHandle(this->handler);
-  }
+  closeSerial();
+  CloseHandle(readOverlapped.hEvent);
+  CloseHandle(writeOverlapped.hEvent);
+  CloseHandle(waitOverlapped.hEvent);
 }
 
 // Reading bytes from serial port to buffer;
 // returns read bytes count, or if error occurs, returns 0
-int SerialPort::readSerialPort(const char *buffer, unsigned int buf_size) {
+int SerialPort::readSerialPort(char *buffer, unsigned int buf_size) {
   DWORD bytesRead{};
-  unsigned int toRead = 0;
-  ClearCommError(this->handler, &this->errors, &this->status);
-  cto.ReadIntervalTimeout = 0;
-  cto.ReadTotalTimeoutConstant = 0;
-  cto.ReadTotalTimeoutMultiplier = 0;
-  SetCommTimeouts(this->handler, &cto);
-  if (this->status.cbInQue > 0) {
-    if (this->status.cbInQue > buf_size) {
-      toRead = buf_size;
-    } else {
-      toRead = this->status.cbInQue;
+  if (!ReadFile(this->handler, buffer, buf_size, &bytesRead,
+                &readOverlapped)) {
+    // With the timeouts set at open a pending read completes right away
+    if (GetLastError() != ERROR_IO_PENDING ||
+        !GetOverlappedResult(this->handler, &readOverlapped, &bytesRead,
+                             TRUE)) {
+      // Fails as well once the board was unplugged
+      pollConnection();
+      return 0;
     }
   }
-
-  memset((void *)buffer, 0, buf_size);
-
-  if (ReadFile(this->handler, (void *)buffer, toRead, &bytesRead, NULL)) {
-    return bytesRead;
-  }
-
-  return 0;
+  return bytesRead;
 }
 
 // Sending provided buffer to serial port;
@@ -110,16 +107,22 @@ int SerialPort::readSerialPort(const char *buffer, unsigned int buf_size) {
 bool SerialPort::writeSerialPort(const char *buffer, unsigned int buf_size) {
   DWORD bytesSend;
 
-  if (!WriteFile(this->handler, (void *)buffer, buf_size, &bytesSend, 0)) {
-    ClearCommError(this->handler, &this->errors, &this->status);
-    return false;
+  if (!WriteFile(this->handler, (void *)buffer, buf_size, &bytesSend,
+                 &writeOverlapped)) {
+    if (GetLastError() != ERROR_IO_PENDING ||
+        !GetOverlappedResult(this->handler, &writeOverlapped, &bytesSend,
+                             TRUE)) {
+      // The thread that owns the port finds out whether it is gone, a
+      // writer only reports the failed write
+      return false;
+    }
   }
 
   return true;
 }
 
 // Checking if serial port is connected
-bool SerialPort::isConnected() {
+bool SerialPort::pollConnection() {
   if (!ClearCommError(this->handler, &this->errors, &this->status)) {
     this->connected = false;
   }
@@ -127,4 +130,80 @@ bool SerialPort::isConnected() {
   return this->connected;
 }
 
-void SerialPort::closeSerial() { CloseHandle(this->handler); }
+void SerialPort::closeSerial() {
+  if (this->handler != INVALID_HANDLE_VALUE) {
+    CloseHandle(this->handler);
+    this->handler = INVALID_HANDLE_VALUE;
+  }
+  this->connected = false;
+  this->waitPending = false;
+}
+
+bool SerialPort::reopen() {
+  closeSerial();
+  // Whatever half line was received before the board dropped off is stale
+  lineFramer.reset();
+  openPort();
+  return this->connected;
+}
+
+// Starts waiting for the next received byte unless a wait is pending already;
+// the returned event is signalled as soon as bytes arrive
+HANDLE SerialPort::armReadWait() {
+  if (!waitPending) {
+    ResetEvent(waitOverlapped.hEvent);
+    if (WaitCommEvent(this->handler, &waitEventMask, &waitOverlapped)) {
+      SetEvent(waitOverlapped.hEvent);
+    } else if (GetLastError() == ERROR_IO_PENDING) {
+      waitPending = true;
+    }
+  }
+  return waitOverlapped.hEvent;
+}
+
+void SerialPort::completeReadWait() {
+  DWORD unused;
+  if (waitPending &&
+      (GetOverlappedResult(this->handler, &waitOverlapped, &unused, FALSE) ||
+       GetLastError() != ERROR_IO_INCOMPLETE)) {
+    waitPending = false;
+  }
+}
+
+// Returns true if there is data to read or a wake handle was signalled
+bool SerialPort::waitForData(SerialPort *const *ports, int count,
+                             unsigned long timeoutMs,
+                             const NativeHandle *wakeHandles, int wakeCount) {
+  // Windows can't wait on more than 64 handles at once. Ports past that
+  // don't wake the wait but are still read once it returns. The wake
+  // handles go first so they are never crowded out.
+  HANDLE events[MAXIMUM_WAIT_OBJECTS];
+  int waitCount = 0;
+  for (int i = 0; i < wakeCount && waitCount < MAXIMUM_WAIT_OBJECTS; i++) {
+    events[waitCount++] = wakeHandles[i];
+  }
+
+  for (int i = 0; i < count && waitCount < MAXIMUM_WAIT_OBJECTS; i++) {
+    if (!ports[i]->pollConnection()) {
+      continue;
+    }
+    // Bytes that arrived before the wait was armed don't raise EV_RXCHAR
+    if (ports[i]->status.cbInQue > 0) {
+      return true;
+    }
+    events[waitCount++] = ports[i]->armReadWait();
+  }
+
+  if (waitCount == 0) {
+    Sleep(timeoutMs);
+    return false;
+  }
+
+  DWORD result = WaitForMultipleObjects(waitCount, events, FALSE, timeoutMs);
+  for (int i = 0; i < count; i++) {
+    ports[i]->completeReadWait();
+  }
+  return result < WAIT_OBJECT_0 + waitCount;
+}
+
+#endif  // _WIN32
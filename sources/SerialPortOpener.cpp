@@ -0,0 +1,96 @@
+#include "headers/SerialPortOpener.h"
+
+#include <headers/constants.h>
+#include <settings/settingshandler.h>
+
+#include <algorithm>
+#include <chrono>
+#include <future>
+#include <iostream>
+#include <thread>
+
+std::vector<SerialPort *> openSerialPorts(
+    const std::vector<std::string> &portNames) {
+  std::vector<std::future<SerialPort *>> opening;
+  opening.reserve(portNames.size());
+  for (const auto &portName : portNames) {
+    opening.push_back(std::async(std::launch::async, [portName] {
+      return new SerialPort(portName.c_str());
+    }));
+  }
+
+  std::vector<SerialPort *> ports;
+  ports.reserve(portNames.size());
+  int settleTimeMs = 0;
+  for (auto &port : opening) {
+    ports.push_back(port.get());
+    if (ports.back()->isConnected()) {
+      settleTimeMs = std::max(settleTimeMs, ports.back()->settleTimeMs());
+    }
+  }
+  std::this_thread::sleep_for(std::chrono::milliseconds(settleTimeMs));
+  return ports;
+}
+
+bool handshakeSerialPorts(const std::vector<SerialPort *> &ports) {
+  SettingsHandler settingsHandler;
+  std::string probe =
+      settingsHandler.retrieveSetting("Settings", "boardHandshakeLineEdit")
+          ->toString()
+          .toStdString();
+  if (probe.empty()) {
+    return std::all_of(ports.begin(), ports.end(),
+                       [](SerialPort *port) { return port->isConnected(); });
+  }
+  probe += '\n';
+
+  bool allConnected = true;
+  std::vector<SerialPort *> waiting;
+  for (auto *port : ports) {
+    if (port->isConnected() &&
+        port->writeSerialPort(probe.c_str(), probe.size())) {
+      waiting.push_back(port);
+    } else {
+      allConnected = false;
+    }
+  }
+
+  // All boards answer in parallel, so every one of them gets the full
+  // timeout counted from the moment the probes went out
+  const auto deadline =
+      std::chrono::steady_clock::now() +
+      std::chrono::milliseconds(constants::boardHandshakeTimeoutMs);
+  while (!waiting.empty()) {
+    const auto remaining =
+        std::chrono::duration_cast<std::chrono::milliseconds>(
+            deadline - std::chrono::steady_clock::now())
+            .count();
+    if (remaining <= 0) {
+      break;
+    }
+    SerialPort::waitForData(waiting.data(), waiting.size(), remaining);
+    waiting.erase(std::remove_if(waiting.begin(), waiting.end(),
+                                 [&allConnected](SerialPort *port) {
+                                   if (!port->isConnected()) {
+                                     allConnected = false;
+                                     return true;
+                                   }
+                                   return port->fillLineFramer() > 0;
+                                 }),
+                  waiting.end());
+  }
+
+  // The reply to the probe is not an input command, the readers must not
+  // see it
+  for (auto *port : ports) {
+    port->discardLines();
+  }
+
+  for (size_t i = 0; i < ports.size(); i++) {
+    if (std::find(waiting.begin(), waiting.end(), ports[i]) != waiting.end()) {
+      std::cerr << "Board " << i << " did not answer the handshake"
+                << std::endl;
+    }
+  }
+  return allConnected && waiting.empty();
+}
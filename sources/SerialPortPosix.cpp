@@ -0,0 +1,235 @@
+// termios backend of SerialPort for platforms other than Windows
+
+#ifndef _WIN32
+
+#include <fcntl.h>
+#include <poll.h>
+#include <termios.h>
+#include <unistd.h>
+
+#include <cerrno>
+#include <chrono>
+#include <cstring>
+#include <iostream>
+#include <thread>
+#include <vector>
+
+#include "headers/SerialPort.hpp"
+
+namespace {
+
+// How long a write waits for the driver to take more bytes before it gives
+// up on the port
+constexpr int writeTimeoutMs = 100;
+
+// False for rates termios has no constant for
+bool toSpeed(int baudRate, speed_t *speed) {
+  switch (baudRate) {
+    case 9600:
+      *speed = B9600;
+      return true;
+    case 19200:
+      *speed = B19200;
+      return true;
+    case 38400:
+      *speed = B38400;
+      return true;
+    case 57600:
+      *speed = B57600;
+      return true;
+    case 115200:
+      *speed = B115200;
+      return true;
+    case 230400:
+      *speed = B230400;
+      return true;
+    default:
+      return false;
+  }
+}
+
+}  // namespace
+
+SerialPort::SerialPort(const char *portName) : portName(portName) {
+  std::cout << portName << std::endl;
+  openPort();
+}
+
+void SerialPort::openPort() {
+  this->connected = false;
+  loadSettings();
+
+  // A board that talks at another rate than the one configured only sends
+  // garbage, so an unsupported rate fails the open instead
+  speed_t speed;
+  if (!toSpeed(baudRate, &speed)) {
+    std::cerr << "ERROR: " << portName << ": unsupported baud rate "
+              << baudRate << "\n";
+    this->handler = -1;
+    return;
+  }
+
+  this->handler =
+      open(portName.c_str(), O_RDWR | O_NOCTTY | O_NONBLOCK | O_CLOEXEC);
+  if (this->handler < 0) {
+    std::cerr << "ERROR: Handle was not attached.Reason : " << portName << " "
+              << std::strerror(errno) << "\n";
+    return;
+  }
+
+  // 8N1 raw mode, configured once here so reads and writes are plain
+  // syscalls afterwards
+  termios options;
+  if (tcgetattr(this->handler, &options) != 0) {
+    std::cerr << "Failed to get current serial parameters\n";
+    closeSerial();
+    return;
+  }
+  cfmakeraw(&options);
+  cfsetispeed(&options, speed);
+  cfsetospeed(&options, speed);
+  options.c_cflag |= CLOCAL | CREAD;
+  options.c_cflag &= ~(PARENB | CSTOPB | CSIZE);
+  options.c_cflag |= CS8;
+  options.c_cc[VMIN] = 0;
+  options.c_cc[VTIME] = 0;
+  std::cout << "DCB" << baudRate << std::endl;
+
+  if (tcsetattr(this->handler, TCSANOW, &options) != 0) {
+    std::cout << "ALERT: could not set serial port parameters\n";
+    closeSerial();
+    return;
+  }
+  this->connected = true;
+  tcflush(this->handler, TCIOFLUSH);
+}
+
+SerialPort::~SerialPort() { closeSerial(); }
+
+// Reading bytes from serial port to buffer;
+// returns read bytes count, or if error occurs, returns 0
+int SerialPort::readSerialPort(char *buffer, unsigned int buf_size) {
+  if (this->handler < 0) {
+    return 0;
+  }
+  const ssize_t bytesRead = read(this->handler, buffer, buf_size);
+  if (bytesRead > 0) {
+    return static_cast<int>(bytesRead);
+  }
+  if (bytesRead < 0 && errno != EAGAIN && errno != EINTR) {
+    // The board was unplugged or the other end of a pty closed
+    this->connected = false;
+  }
+  return 0;
+}
+
+// Sending provided buffer to serial port;
+// returns true if succeed, false if not
+bool SerialPort::writeSerialPort(const char *buffer, unsigned int buf_size) {
+  if (!this->connected) {
+    return false;
+  }
+  unsigned int sent = 0;
+  while (sent < buf_size) {
+    const ssize_t written =
+        write(this->handler, buffer + sent, buf_size - sent);
+    if (written > 0) {
+      sent += written;
+      continue;
+    }
+    if (written < 0 && errno == EINTR) {
+      continue;
+    }
+    if (written < 0 && errno != EAGAIN) {
+      // The thread that owns the port finds out whether it is gone, a
+      // writer only reports the failed write
+      return false;
+    }
+    // The driver's buffer is full, wait until it drained a bit
+    pollfd ready = {this->handler, POLLOUT, 0};
+    if (poll(&ready, 1, writeTimeoutMs) <= 0) {
+      return false;
+    }
+  }
+  return true;
+}
+
+// Checking if serial port is connected
+bool SerialPort::pollConnection() {
+  if (this->handler < 0) {
+    return false;
+  }
+  // An unplugged board or a closed pty reports a hangup without reading
+  pollfd ready = {this->handler, 0, 0};
+  if (poll(&ready, 1, 0) > 0 &&
+      (ready.revents & (POLLHUP | POLLERR | POLLNVAL))) {
+    this->connected = false;
+  }
+  return this->connected;
+}
+
+void SerialPort::closeSerial() {
+  if (this->handler >= 0) {
+    close(this->handler);
+    this->handler = -1;
+  }
+  this->connected = false;
+}
+
+bool SerialPort::reopen() {
+  closeSerial();
+  // Whatever half line was received before the board dropped off is stale
+  lineFramer.reset();
+  openPort();
+  return this->connected;
+}
+
+// Returns true if there is data to read or a wake handle was signalled
+bool SerialPort::waitForData(SerialPort *const *ports, int count,
+                             unsigned long timeoutMs,
+                             const NativeHandle *wakeHandles, int wakeCount) {
+  // Kept per thread so waiting doesn't allocate once the tables have grown
+  // to the number of boards
+  thread_local std::vector<pollfd> fds;
+  thread_local std::vector<SerialPort *> polled;
+  fds.clear();
+  polled.clear();
+
+  // Wake handles have no port behind them
+  for (int i = 0; i < wakeCount; i++) {
+    fds.push_back({wakeHandles[i], POLLIN, 0});
+    polled.push_back(nullptr);
+  }
+  for (int i = 0; i < count; i++) {
+    if (!ports[i]->isConnected()) {
+      continue;
+    }
+    fds.push_back({ports[i]->handler, POLLIN, 0});
+    polled.push_back(ports[i]);
+  }
+
+  if (fds.empty()) {
+    std::this_thread::sleep_for(std::chrono::milliseconds(timeoutMs));
+    return false;
+  }
+
+  // poll() rather than epoll: every input reader waits on its own port and
+  // the dual worker on a few ports and wake handles, and the set changes
+  // whenever a board drops off. An epoll instance would need the same
+  // bookkeeping in extra syscalls and only pays off for large sets.
+  if (poll(fds.data(), fds.size(), static_cast<int>(timeoutMs)) <= 0) {
+    return false;
+  }
+  bool readable = false;
+  for (size_t i = 0; i < fds.size(); i++) {
+    if (fds[i].revents & POLLIN) {
+      readable = true;
+    } else if (polled[i] != nullptr &&
+               (fds[i].revents & (POLLHUP | POLLERR | POLLNVAL))) {
+      polled[i]->connected = false;
+    }
+  }
+  return readable;
+}
+
+#endif  // _WIN32
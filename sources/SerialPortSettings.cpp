@@ -0,0 +1,20 @@
+// The part of SerialPort that needs Qt, shared by both backends
+
+#include <settings/settingshandler.h>
+
+#include "headers/SerialPort.hpp"
+
+// Reads the wait time and baud rate of the connection from the settings
+void SerialPort::loadSettings() {
+  SettingsHandler settingsHandler;
+  arduinoWaitTime =
+      settingsHandler.retrieveSetting("com", "waitXMsBeforeSendingLineEdit")
+          ->toInt();
+  if (settingsHandler.retrieveSetting("com", "waitXMsBeforeSendingLineEdit")
+          ->isNull()) {
+    arduinoWaitTime = 15;
+  }
+  if (!settingsHandler.retrieveSetting("com", "CBR")->isNull()) {
+    baudRate = settingsHandler.retrieveSetting("com", "CBR")->toInt();
+  }
+}
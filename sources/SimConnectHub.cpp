@@ -0,0 +1,259 @@
+#include "headers/SimConnectHub.h"
+
+#include <Inputs/InputMapper.h>
+#include <Inputs/encoderaggregator.h>
+#include <headers/WakeEvent.h>
+#include <headers/constants.h>
+
+#include <algorithm>
+#include <chrono>
+#include <cstring>
+#include <iostream>
+#include <thread>
+
+namespace {
+
+using NativeHandle = SerialPort::NativeHandle;
+
+// SimConnect_Open takes the event as a HANDLE, the stand-in reads an
+// eventfd back out of it
+HANDLE asSimConnectEvent(NativeHandle event) {
+#ifdef _WIN32
+  return event;
+#else
+  return reinterpret_cast<HANDLE>(static_cast<intptr_t>(event));
+#endif
+}
+
+bool inRanges(const std::vector<SimConnectHub::IdRange> &ranges, DWORD id) {
+  return std::any_of(ranges.begin(), ranges.end(),
+                     [id](const SimConnectHub::IdRange &range) {
+                       return id >= range.first && id <= range.last;
+                     });
+}
+
+constexpr size_t paddedSize(size_t size) { return (size + 7) & ~size_t{7}; }
+
+}  // namespace
+
+SimConnectHub::SimConnectHub() : sessionEvent(createWakeEvent()) {}
+
+SimConnectHub &SimConnectHub::instance() {
+  static SimConnectHub hub;
+  return hub;
+}
+
+int SimConnectHub::subscribe(DispatchProc proc, void *context,
+                             Routes routes) {
+  std::lock_guard<std::mutex> guard(mutex);
+  auto slot = std::find_if(subscribers.begin(), subscribers.end(),
+                           [](const Subscriber &s) { return !s.active; });
+  if (slot == subscribers.end()) {
+    subscribers.emplace_back().wakeEvent = createWakeEvent();
+    slot = subscribers.end() - 1;
+  }
+  slot->active = true;
+  slot->proc = proc;
+  slot->context = context;
+  slot->routes = std::move(routes);
+  slot->generation = 0;
+  slot->mailbox.clear();
+  return static_cast<int>(slot - subscribers.begin());
+}
+
+void SimConnectHub::unsubscribe(int subscriber) {
+  std::lock_guard<std::mutex> guard(mutex);
+  subscribers[subscriber].active = false;
+  subscribers[subscriber].mailbox.clear();
+  if (open && std::none_of(subscribers.begin(), subscribers.end(),
+                           [](const Subscriber &s) { return s.active; })) {
+    endSession();
+  }
+}
+
+bool SimConnectHub::connect(int subscriber, const bool &abort,
+                            const std::function<void()> &idle) {
+  while (!abort) {
+    {
+      std::lock_guard<std::mutex> guard(mutex);
+      if (open) {
+        subscribers[subscriber].generation = generation;
+        return true;
+      }
+    }
+
+    // Only one subscriber knocks on the sim, the others wait for it. If
+    // that one is stopped before the sim is up the next one takes over.
+    std::unique_lock<std::mutex> opening(openMutex, std::try_to_lock);
+    if (!opening.owns_lock()) {
+      if (idle) {
+        idle();
+      }
+      std::this_thread::sleep_for(
+          std::chrono::milliseconds(constants::serialWaitTimeoutMs));
+      continue;
+    }
+    HANDLE opened = nullptr;
+    if (!reconnector.open(&opened, abort, idle,
+                          asSimConnectEvent(sessionEvent))) {
+      return false;
+    }
+    std::lock_guard<std::mutex> guard(mutex);
+    handle = opened;
+    open = true;
+    quitReceived = false;
+    generation++;
+    claimedDefinitions.clear();
+    setUpSession();
+    subscribers[subscriber].generation = generation;
+    return true;
+  }
+  return false;
+}
+
+SimConnectHub::Session SimConnectHub::lock(int subscriber) {
+  Session session(mutex, nullptr, false);
+  session.sessionHandle = handle;
+  session.isValid = current(subscribers[subscriber]);
+  return session;
+}
+
+bool SimConnectHub::dispatch(int subscriber) {
+  std::unique_lock<std::mutex> guard(mutex);
+  Subscriber &self = subscribers[subscriber];
+  if (!current(self)) {
+    return false;
+  }
+  // Reset before draining, whatever SimConnect queues from here on signals
+  // the event again
+  resetWakeEvent(sessionEvent);
+  if (FAILED(SimConnect_CallDispatch(handle, &SimConnectHub::route, this))) {
+    std::cout << "SimConnect dispatch failed, closing the session"
+              << std::endl;
+    endSession();
+    return false;
+  }
+  // The mailbox keeps its capacity, once it has grown to a frame's worth of
+  // messages delivering doesn't allocate anymore
+  self.delivering.swap(self.mailbox);
+  resetWakeEvent(self.wakeEvent);
+  // A QUIT is still delivered to this subscriber, the others find out from
+  // their next dispatch()
+  if (quitReceived) {
+    endSession();
+  }
+  const bool stillCurrent = current(self);
+  // A slow DispatchProc only holds up its own mode, and it can lock the hub
+  // for the calls it makes
+  guard.unlock();
+  deliver(self);
+  return stillCurrent;
+}
+
+std::array<NativeHandle, 2> SimConnectHub::wakeHandles(int subscriber) {
+  std::lock_guard<std::mutex> guard(mutex);
+  return {sessionEvent, subscribers[subscriber].wakeEvent};
+}
+
+bool SimConnectHub::claimClientDataDefinition(
+    SIMCONNECT_CLIENT_DATA_DEFINITION_ID id) {
+  return claimedDefinitions.insert(id).second;
+}
+
+void CALLBACK SimConnectHub::route(SIMCONNECT_RECV *data, DWORD size,
+                                   void *context) {
+  auto *hub = static_cast<SimConnectHub *>(context);
+  std::vector<IdRange> Routes::*ranges = nullptr;
+  DWORD id = 0;
+
+  switch (data->dwID) {
+    case SIMCONNECT_RECV_ID_EVENT:
+    case SIMCONNECT_RECV_ID_EVENT_OBJECT_ADDREMOVE:
+    case SIMCONNECT_RECV_ID_EVENT_FILENAME:
+    case SIMCONNECT_RECV_ID_EVENT_FRAME:
+      ranges = &Routes::events;
+      id = reinterpret_cast<SIMCONNECT_RECV_EVENT *>(data)->uEventID;
+      break;
+    case SIMCONNECT_RECV_ID_SIMOBJECT_DATA:
+    case SIMCONNECT_RECV_ID_SIMOBJECT_DATA_BYTYPE:
+      ranges = &Routes::objectData;
+      id = reinterpret_cast<SIMCONNECT_RECV_SIMOBJECT_DATA *>(data)
+               ->dwRequestID;
+      break;
+    case SIMCONNECT_RECV_ID_CLIENT_DATA:
+      ranges = &Routes::clientData;
+      id = reinterpret_cast<SIMCONNECT_RECV_CLIENT_DATA *>(data)->dwRequestID;
+      break;
+    case SIMCONNECT_RECV_ID_OPEN:
+      return;
+    case SIMCONNECT_RECV_ID_QUIT:
+      hub->quitReceived = true;
+      break;
+    default:
+      // Exceptions and the rest go to everyone
+      break;
+  }
+
+  for (auto &subscriber : hub->subscribers) {
+    if (subscriber.active && hub->current(subscriber) &&
+        (ranges == nullptr || inRanges(subscriber.routes.*ranges, id))) {
+      hub->post(subscriber, data, size);
+    }
+  }
+}
+
+void SimConnectHub::post(Subscriber &subscriber, const SIMCONNECT_RECV *data,
+                         DWORD size) {
+  const size_t offset = subscriber.mailbox.size();
+  subscriber.mailbox.resize(offset + sizeof(DWORD) * 2 + paddedSize(size));
+  std::memcpy(subscriber.mailbox.data() + offset, &size, sizeof(DWORD));
+  std::memcpy(subscriber.mailbox.data() + offset + sizeof(DWORD) * 2, data,
+              size);
+  signalWakeEvent(subscriber.wakeEvent);
+}
+
+// Runs without the hub's lock, on the subscriber's own thread
+void SimConnectHub::deliver(Subscriber &subscriber) {
+  size_t offset = 0;
+  while (offset < subscriber.delivering.size()) {
+    DWORD size;
+    std::memcpy(&size, subscriber.delivering.data() + offset, sizeof(DWORD));
+    auto *data = reinterpret_cast<SIMCONNECT_RECV *>(
+        subscriber.delivering.data() + offset + sizeof(DWORD) * 2);
+    subscriber.proc(data, size, subscriber.context);
+    offset += sizeof(DWORD) * 2 + paddedSize(size);
+  }
+  subscriber.delivering.clear();
+}
+
+// What every mode needs, done once per session instead of once per mode
+void SimConnectHub::setUpSession() {
+  SimConnect_MapClientDataNameToID(handle, "shared", sharedClientDataID);
+  SimConnect_CreateClientData(handle, sharedClientDataID, 4096,
+                              SIMCONNECT_CREATE_CLIENT_DATA_FLAG_DEFAULT);
+  SimConnect_AddToClientDataDefinition(handle, commandDefinitionID,
+                                       SIMCONNECT_CLIENTDATAOFFSET_AUTO, 256,
+                                       0);
+
+  SimConnect_MapClientDataNameToID(handle, "wasm.responses",
+                                   responsesClientDataID);
+  SimConnect_CreateClientData(handle, responsesClientDataID, 4096,
+                              SIMCONNECT_CREATE_CLIENT_DATA_FLAG_DEFAULT);
+
+  InputMapper mapper;
+  mapper.mapEvents(handle);
+  EncoderAggregator::defineValues(handle);
+  SimConnect_SubscribeToSystemEvent(handle, InputEnum::EVENT_AXIS_FRAME,
+                                    "Frame");
+}
+
+void SimConnectHub::endSession() {
+  SimConnect_Close(handle);
+  handle = nullptr;
+  open = false;
+  for (auto &subscriber : subscribers) {
+    subscriber.mailbox.clear();
+    // Lets the ones that are waiting find out from dispatch()
+    signalWakeEvent(subscriber.wakeEvent);
+  }
+}
@@ -0,0 +1,37 @@
+#include "headers/SimConnectReconnector.h"
+
+#include <headers/constants.h>
+
+#include <algorithm>
+#include <chrono>
+#include <thread>
+
+SimConnectReconnector::SimConnectReconnector(const char *name)
+    : name(name), random(std::random_device{}()) {}
+
+bool SimConnectReconnector::open(HANDLE *handle, const bool &abort,
+                                 const std::function<void()> &idle,
+                                 HANDLE eventHandle) {
+  int waitMs = constants::simConnectRetryMinMs;
+  attempts = 0;
+  while (!abort) {
+    if (SUCCEEDED(SimConnect_Open(handle, name, nullptr, 0, eventHandle, 0))) {
+      return true;
+    }
+    attempts++;
+
+    std::uniform_int_distribution<int> jitter(0, waitMs / 4);
+    const auto retryAt = std::chrono::steady_clock::now() +
+                         std::chrono::milliseconds(waitMs + jitter(random));
+    while (!abort && std::chrono::steady_clock::now() < retryAt) {
+      if (idle) {
+        idle();
+      }
+      std::this_thread::sleep_for(std::min<std::chrono::nanoseconds>(
+          retryAt - std::chrono::steady_clock::now(),
+          std::chrono::milliseconds(constants::serialWaitTimeoutMs)));
+    }
+    waitMs = std::min(waitMs * 2, constants::simConnectRetryMaxMs);
+  }
+  return false;
+}
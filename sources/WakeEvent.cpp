@@ -0,0 +1,46 @@
+#include "headers/WakeEvent.h"
+
+#include <cstdint>
+
+#ifndef _WIN32
+#include <sys/eventfd.h>
+#include <unistd.h>
+#endif
+
+SerialPort::NativeHandle createWakeEvent() {
+#ifdef _WIN32
+  return CreateEvent(nullptr, FALSE, FALSE, nullptr);
+#else
+  return eventfd(0, EFD_NONBLOCK | EFD_CLOEXEC);
+#endif
+}
+
+void closeWakeEvent(SerialPort::NativeHandle event) {
+#ifdef _WIN32
+  CloseHandle(event);
+#else
+  close(event);
+#endif
+}
+
+void signalWakeEvent(SerialPort::NativeHandle event) {
+#ifdef _WIN32
+  SetEvent(event);
+#else
+  const uint64_t one = 1;
+  // Only fails when the counter is full, the event is signalled then anyway
+  const ssize_t written = write(event, &one, sizeof(one));
+  static_cast<void>(written);
+#endif
+}
+
+void resetWakeEvent(SerialPort::NativeHandle event) {
+#ifdef _WIN32
+  ResetEvent(event);
+#else
+  // Fails with EAGAIN when the event wasn't signalled, which is fine
+  uint64_t count;
+  const ssize_t received = read(event, &count, sizeof(count));
+  static_cast<void>(received);
+#endif
+}
@@ -0,0 +1,167 @@
+// Compares the baked curve and throttle tables with the float code the
+// handler ran for every sample before, for every 10-bit input value. The
+// old code is copied here as it was.
+
+#include <Inputs/axiscurve.h>
+#include <settings/coordinates.h>
+
+#include <algorithm>
+#include <climits>
+#include <cstdio>
+#include <vector>
+
+#include "check.h"
+
+namespace {
+
+using Curve = std::vector<coordinates>;
+
+constexpr float closedAxis = -16383.0;
+constexpr float openAxis = 16383.0;
+
+int legacyMapCoordinates(int value, coordinates toMapMin,
+                         coordinates toMapMax) {
+  return toMapMin.getY() +
+         (toMapMax.getY() - toMapMin.getY()) *
+             ((value - toMapMin.getX()) / (toMapMax.getX() - toMapMin.getX()));
+}
+
+// InputSwitchHandler::calibratedRange before the tables. It left the axis
+// unset past the last point, INT_MIN marks that here.
+int legacyCalibratedRange(int value, const Curve &curve) {
+  int axis = INT_MIN;
+
+  if (static_cast<float>(value) <= curve[1].getX()) {
+    axis = legacyMapCoordinates(value, curve[0], curve.at(1));
+  }
+  // minCurve
+  else if (static_cast<float>(value) < curve[2].getX()) {
+    axis = legacyMapCoordinates(value, curve[1], curve[2]);
+  }
+  // deadzone
+  else if (static_cast<float>(value) >= curve[2].getX() &&
+           static_cast<float>(value) <= curve[4].getX()) {
+    axis = 0;
+  } else if (static_cast<float>(value) <= curve[5].getX()) {
+    axis = legacyMapCoordinates(static_cast<float>(value), curve[4],
+                                curve[5]);
+  } else if (static_cast<float>(value) <= curve[6].getX()) {
+    axis = legacyMapCoordinates(static_cast<float>(value), curve[5],
+                                curve[6]);
+  }
+  return axis;
+}
+
+int legacyMapThrottleValueToAxis(int value, float reverse, float max,
+                                 int idleCutoff, float reverseAxis) {
+  int valueThrottle;
+  bool reversed = max < idleCutoff;
+
+  if ((reversed && idleCutoff - reverse < 0 && value >= idleCutoff) ||
+      (!reversed && idleCutoff - reverse > 0 && value <= idleCutoff)) {
+    valueThrottle =
+        reverseAxis + (closedAxis - reverseAxis) *
+                          ((value - reverse) / (idleCutoff - reverse));
+  } else {
+    valueThrottle =
+        closedAxis +
+        (openAxis - closedAxis) * ((value - idleCutoff) / (max - idleCutoff));
+  }
+  if (valueThrottle > 16383) {
+    return 16383;
+  }
+  return valueThrottle;
+}
+
+int clampToEntry(int axis) { return std::clamp(axis, -32768, 32767); }
+
+void checkCurve(const char *name, const Curve &curve) {
+  axiscurve::Table table;
+  axiscurve::bakeCurve(curve, &table);
+  int mismatches = 0;
+  for (int value = 0; value < constants::axisResolution; value++) {
+    int expected = legacyCalibratedRange(value, curve);
+    if (expected == INT_MIN) {
+      // Past the last point the table holds that point's value
+      expected = static_cast<int>(curve[6].getY());
+    }
+    if (axiscurve::lookup(table, value) != clampToEntry(expected) &&
+        mismatches++ < 5) {
+      std::printf("%s: %d maps to %d, was %d\n", name, value,
+                  axiscurve::lookup(table, value), expected);
+    }
+  }
+  CHECK(mismatches == 0);
+
+  // Samples outside the 10-bit range land on the first or last entry
+  CHECK(axiscurve::lookup(table, -1) == table[0]);
+  CHECK(axiscurve::lookup(table, INT_MIN) == table[0]);
+  CHECK(axiscurve::lookup(table, constants::axisResolution) ==
+        table[constants::axisResolution - 1]);
+  CHECK(axiscurve::lookup(table, INT_MAX) ==
+        table[constants::axisResolution - 1]);
+}
+
+void checkThrottle(const char *name, float reverse, float max, int idleCutoff,
+                   float reverseAxis) {
+  axiscurve::Table table;
+  axiscurve::bakeThrottle(reverse, max, idleCutoff, reverseAxis, &table);
+  int mismatches = 0;
+  for (int value = 0; value < constants::axisResolution; value++) {
+    const int expected = legacyMapThrottleValueToAxis(value, reverse, max,
+                                                      idleCutoff, reverseAxis);
+    if (axiscurve::lookup(table, value) != clampToEntry(expected) &&
+        mismatches++ < 5) {
+      std::printf("%s: %d maps to %d, was %d\n", name, value,
+                  axiscurve::lookup(table, value), expected);
+    }
+  }
+  CHECK(mismatches == 0);
+}
+
+void testCurves() {
+  // The curve the handler sets up when ranges were saved, and the one it
+  // falls back to otherwise
+  checkCurve("saved default",
+             {coordinates(0, -16383), coordinates(250, -10000),
+              coordinates(400, 0), coordinates(500, 0), coordinates(600, 0),
+              coordinates(750, 10000), coordinates(1023, 16383)});
+  checkCurve("fallback default",
+             {coordinates(0, -16383), coordinates(250, -10000),
+              coordinates(500, 0), coordinates(511, 0), coordinates(522, 0),
+              coordinates(750, 10000), coordinates(1023, 16383)});
+  // What the calibration menu produces: fractional points, no deadzone and
+  // a curve that ends before the pot does
+  checkCurve("calibrated",
+             {coordinates(12.5f, -16383), coordinates(180.25f, -9000),
+              coordinates(511.5f, 0), coordinates(511.5f, 0),
+              coordinates(511.5f, 0), coordinates(820.75f, 12000),
+              coordinates(1001, 16383)});
+  checkCurve("short",
+             {coordinates(100, -16383), coordinates(200, -8000),
+              coordinates(300, 0), coordinates(350, 0), coordinates(400, 0),
+              coordinates(600, 8000), coordinates(700, 16383)});
+}
+
+void testThrottles() {
+  const float reverseAxis = -23000.0;
+  // Engine(0, 0, 1023), what every engine gets without saved ranges
+  checkThrottle("default", 0, 1023, 0, reverseAxis);
+  // A reverse range below idle
+  checkThrottle("reverse range", 0, 1023, 200, reverseAxis);
+  // Potentiometers mounted backwards, with and without a reverse range
+  checkThrottle("backwards", 1023, 0, 800, reverseAxis);
+  checkThrottle("backwards without reverse", 800, 0, 800, reverseAxis);
+  // A reverse range that starts above 0, the lowest values go past int16
+  // and are clamped
+  checkThrottle("short reverse", 200, 1000, 300, reverseAxis);
+  checkThrottle("configured reverse", 50, 980, 150, -20000.0);
+}
+
+}  // namespace
+
+int main() {
+  testCurves();
+  testThrottles();
+  return testResult();
+}
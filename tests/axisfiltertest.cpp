@@ -0,0 +1,229 @@
+// Runs AxisFilter over synthetic potentiometer traces: a slow movement with
+// noise on top, single sample spikes and dips like a dirty wiper produces,
+// and hard steps. The traces are generated from fixed seeds since no
+// recordings of real boards are kept in the repo.
+
+#include <Inputs/axisfilter.h>
+
+#include <algorithm>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <random>
+#include <vector>
+
+#include "check.h"
+
+namespace {
+
+struct Trace {
+  // What the pot would read without noise
+  std::vector<int> clean;
+  std::vector<int> raw;
+};
+
+int toAdc(double value) {
+  return std::clamp(static_cast<int>(std::lround(value)), 0, 1023);
+}
+
+// A lever moved slowly back and forth with a pause at each end, plus
+// gaussian noise of the given spread and a spike or dip every spikeEvery
+// samples (0 for none)
+Trace potentiometer(unsigned seed, double noise, int spikeEvery) {
+  std::mt19937 random(seed);
+  std::normal_distribution<double> jitter(0.0, noise);
+  Trace trace;
+  for (int i = 0; i < 4000; i++) {
+    const double phase = std::clamp(1.25 * std::sin(i / 400.0), 0.0, 1.0);
+    const double position = 100.0 + 800.0 * phase;
+    int raw = toAdc(position + jitter(random));
+    if (spikeEvery > 0 && i % spikeEvery == spikeEvery / 2) {
+      raw = (i / spikeEvery) % 2 == 0 ? 1023 : 3;
+    }
+    trace.clean.push_back(toAdc(position));
+    trace.raw.push_back(raw);
+  }
+  return trace;
+}
+
+std::vector<int> run(const AxisFilterSettings &settings,
+                     const std::vector<int> &samples) {
+  AxisFilter filter;
+  filter.configure(settings);
+  std::vector<int> out;
+  for (const int sample : samples) {
+    out.push_back(filter.apply(sample));
+  }
+  return out;
+}
+
+int largestError(const std::vector<int> &out, const std::vector<int> &clean) {
+  int largest = 0;
+  for (size_t i = 0; i < out.size(); i++) {
+    largest = std::max(largest, std::abs(out[i] - clean[i]));
+  }
+  return largest;
+}
+
+double rmsError(const std::vector<int> &out, const std::vector<int> &clean) {
+  double sum = 0;
+  for (size_t i = 0; i < out.size(); i++) {
+    sum += double(out[i] - clean[i]) * (out[i] - clean[i]);
+  }
+  return std::sqrt(sum / out.size());
+}
+
+// How often the output changes while the lever rests at the top end
+int changesAtRest(const std::vector<int> &out, const std::vector<int> &clean) {
+  int changes = 0;
+  for (size_t i = 1; i < out.size(); i++) {
+    if (clean[i] == clean[i - 1] && clean[i] == 900 && out[i] != out[i - 1]) {
+      changes++;
+    }
+  }
+  return changes;
+}
+
+// Samples until the output is within tolerance of a step from 0 to 1000
+int stepLag(const AxisFilterSettings &settings, int tolerance) {
+  std::vector<int> step(10, 0);
+  step.resize(400, 1000);
+  const std::vector<int> out = run(settings, step);
+  for (size_t i = 10; i < out.size(); i++) {
+    if (std::abs(out[i] - 1000) <= tolerance) {
+      return static_cast<int>(i - 10);
+    }
+  }
+  return -1;
+}
+
+void testOffByDefault() {
+  const Trace trace = potentiometer(1, 4.0, 97);
+  CHECK(run(AxisFilterSettings(), trace.raw) == trace.raw);
+  CHECK(stepLag(AxisFilterSettings(), 0) == 0);
+}
+
+void testMedianRemovesSpikes() {
+  const Trace trace = potentiometer(2, 0.0, 97);
+  CHECK(largestError(trace.raw, trace.clean) > 800);
+
+  AxisFilterSettings settings;
+  settings.medianWindow = 3;
+  const std::vector<int> out = run(settings, trace.raw);
+  // What is left is the one sample the median trails a moving lever by
+  CHECK(largestError(out, trace.clean) <= 8);
+  CHECK(stepLag(settings, 0) == 1);
+
+  settings.medianWindow = 5;
+  CHECK(largestError(run(settings, trace.raw), trace.clean) <= 16);
+  CHECK(stepLag(settings, 0) == 2);
+}
+
+void testSmoothingReducesNoise() {
+  const Trace trace = potentiometer(3, 6.0, 0);
+  AxisFilterSettings settings;
+  settings.smoothing = 75;
+  const std::vector<int> out = run(settings, trace.raw);
+  CHECK(rmsError(out, trace.clean) < rmsError(trace.raw, trace.clean));
+  CHECK(changesAtRest(out, trace.clean) <
+        changesAtRest(trace.raw, trace.clean));
+  // An average that keeps 75 % needs about 16 samples to settle within 1 %
+  const int lag = stepLag(settings, 10);
+  CHECK(lag > 0 && lag <= 20);
+}
+
+void testDeadbandHoldsAtRest() {
+  const Trace trace = potentiometer(4, 2.0, 0);
+  CHECK(changesAtRest(trace.raw, trace.clean) > 100);
+
+  AxisFilterSettings settings;
+  settings.deadband = 8;
+  const std::vector<int> out = run(settings, trace.raw);
+  CHECK(changesAtRest(out, trace.clean) < 5);
+  // The output never trails the input by more than the band
+  for (size_t i = 0; i < out.size(); i++) {
+    CHECK(std::abs(out[i] - trace.raw[i]) <= settings.deadband);
+  }
+  CHECK(stepLag(settings, 0) == 0);
+}
+
+void testSlewFollowsLargeMoves() {
+  // The old rudder rule dropped every jump of 10000 or more, which left the
+  // axis stuck after a fast full deflection. The slew limit gets there.
+  AxisFilterSettings settings;
+  settings.slewLimit = 50;
+  CHECK(stepLag(settings, 0) == 19);
+
+  const Trace trace = potentiometer(5, 0.0, 0);
+  const std::vector<int> out = run(settings, trace.raw);
+  CHECK(out == trace.raw);
+}
+
+void testFullPipeline() {
+  const Trace trace = potentiometer(6, 4.0, 131);
+  AxisFilterSettings settings;
+  settings.medianWindow = 3;
+  settings.smoothing = 50;
+  settings.deadband = 4;
+  settings.slewLimit = 200;
+  const std::vector<int> out = run(settings, trace.raw);
+  CHECK(largestError(out, trace.clean) < 40);
+  CHECK(changesAtRest(out, trace.clean) <
+        changesAtRest(trace.raw, trace.clean) / 4);
+  for (const int value : out) {
+    CHECK(value >= 0 && value <= 1023);
+  }
+}
+
+// The settings the handler uses for axes without AxisFilters settings have
+// to catch what its old per-axis guards caught: a reading under 10 after one
+// of 20 or more on the levers, and jumps on rudder and trim
+void testHandlerDefaultsCatchOldGlitches() {
+  const Trace trace = potentiometer(7, 1.0, 89);
+  AxisFilterSettings lever;
+  lever.medianWindow = 3;
+  lever.deadband = 2;
+  std::vector<int> out = run(lever, trace.raw);
+  for (size_t i = 1; i < out.size(); i++) {
+    CHECK(!(out[i] < 10 && out[i - 1] >= 20));
+  }
+  CHECK(largestError(out, trace.clean) <= 12);
+
+  AxisFilterSettings rudder;
+  rudder.medianWindow = 3;
+  rudder.slewLimit = 300;
+  out = run(rudder, trace.raw);
+  for (size_t i = 1; i < out.size(); i++) {
+    CHECK(std::abs(out[i] - out[i - 1]) < 300);
+  }
+  CHECK(largestError(out, trace.clean) <= 12);
+}
+
+void testReset() {
+  AxisFilterSettings settings;
+  settings.medianWindow = 5;
+  settings.smoothing = 90;
+  settings.deadband = 20;
+  settings.slewLimit = 10;
+  AxisFilter filter;
+  filter.configure(settings);
+  for (int i = 0; i < 50; i++) {
+    filter.apply(1000);
+  }
+  filter.reset();
+  CHECK(filter.apply(0) == 0);
+}
+
+}  // namespace
+
+int main() {
+  testOffByDefault();
+  testMedianRemovesSpikes();
+  testSmoothingReducesNoise();
+  testDeadbandHoldsAtRest();
+  testSlewFollowsLargeMoves();
+  testFullPipeline();
+  testHandlerDefaultsCatchOldGlitches();
+  testReset();
+  return testResult();
+}
@@ -0,0 +1,32 @@
+#ifndef CHECK_H
+#define CHECK_H
+
+// The assertion the tests share: a failed CHECK prints where it failed and
+// is counted, main() returns testResult() so ctest sees the failures.
+
+#include <cstdio>
+
+inline int &checkFailures() {
+  static int failures = 0;
+  return failures;
+}
+
+#define CHECK(condition)                                                 \
+  do {                                                                   \
+    if (!(condition)) {                                                  \
+      std::printf("%s:%d: CHECK(%s) failed\n", __FILE__, __LINE__,       \
+                  #condition);                                           \
+      checkFailures()++;                                                 \
+    }                                                                    \
+  } while (false)
+
+inline int testResult() {
+  if (checkFailures() != 0) {
+    std::printf("%d checks failed\n", checkFailures());
+    return 1;
+  }
+  std::printf("all checks passed\n");
+  return 0;
+}
+
+#endif  // CHECK_H
@@ -0,0 +1,172 @@
+// Several handlers' axis paths on separate threads, the way one handler per
+// board would run them. Each thread owns an InputAxes and a coalescer, feeds
+// them yoke, lever, rudder, trim and brake lines of its own and flushes to
+// its own connection to the SimConnect stand-in. Afterwards every handler
+// has to hold the values of its own board, in its state and in what the sim
+// received. Built with ThreadSanitizer where it is available, so state
+// shared between the handlers fails the test too.
+
+#include <Inputs/axiscoalescer.h>
+#include <Inputs/axiscurve.h>
+#include <Inputs/inputaxes.h>
+#include <Inputs/inputcommand.h>
+#include <Inputs/inputenum.h>
+#include <settings/coordinates.h>
+#include <simconnectstandin.h>
+
+#include <cstdio>
+#include <map>
+#include <string>
+#include <thread>
+#include <utility>
+#include <vector>
+
+#include "check.h"
+
+namespace {
+
+constexpr int handlers = 8;
+constexpr int rounds = 2000;
+
+const std::vector<coordinates> curve = {
+    coordinates(0, -16383), coordinates(250, -10000), coordinates(500, 0),
+    coordinates(511, 0),    coordinates(522, 0),      coordinates(750, 10000),
+    coordinates(1023, 16383)};
+
+struct Board {
+  int index = 0;
+  // Where every lever of this board ends up, far from the ramp before it so
+  // the deadband lets it through
+  int finalValue = 0;
+  HANDLE handle = nullptr;
+  InputAxisState state;
+  // Final value of every event as sent by this board's coalescer
+  std::map<DWORD, int> expected;
+};
+
+void setUp(InputAxes *axes) {
+  for (auto &table : axes->curveTables) {
+    axiscurve::bakeCurve(curve, &table);
+  }
+  for (auto &table : axes->throttleTables) {
+    axiscurve::bakeThrottle(0, 1023, 100, -23000.0, &table);
+  }
+}
+
+void feed(InputAxes *axes, int value) {
+  char line[96];
+  const int lever = value;
+  // Prefixes as in inputdispatch::rows
+  std::snprintf(line, sizeof line, "103 %d %d", lever, 1023 - lever);
+  axes->controlYoke(parseInputCommand(line));
+  std::snprintf(line, sizeof line, "199 %d %d %d %d", lever, lever + 1,
+                lever + 2, lever + 3);
+  axes->setThrottles(parseInputCommand(line));
+  std::snprintf(line, sizeof line, "115 %d %d", lever, lever);
+  axes->setMixture(parseInputCommand(line));
+  std::snprintf(line, sizeof line, "901 %d", lever);
+  axes->setRudder(parseInputCommand(line));
+  std::snprintf(line, sizeof line, "900 %d", lever * 4);
+  axes->setElevatorTrim(parseInputCommand(line));
+  std::snprintf(line, sizeof line, "902 %d %d", lever, lever);
+  axes->setBrakes(parseInputCommand(line));
+}
+
+void run(Board *board) {
+  const std::string name = "Handler " + std::to_string(board->index);
+  SimConnect_Open(&board->handle, name.c_str(), nullptr, 0, nullptr, 0);
+  AxisCoalescer coalescer;
+  InputAxes axes(&coalescer);
+  setUp(&axes);
+
+  for (int round = 0; round < rounds; round++) {
+    feed(&axes, (round * 7 + board->index * 61) % 500);
+    coalescer.frameTick();
+    coalescer.flush(board->handle, AxisCoalescer::Clock::now());
+  }
+  // Median, deadband and slew limit all settle within a few samples
+  for (int round = 0; round < 8; round++) {
+    feed(&axes, board->finalValue);
+    coalescer.frameTick();
+    coalescer.flush(board->handle, AxisCoalescer::Clock::now());
+  }
+  board->state = axes.getState();
+}
+
+// What a board's handler has to end up with, from tables of the test's own
+void expect(Board *board) {
+  axiscurve::Table curveTable;
+  axiscurve::bakeCurve(curve, &curveTable);
+  axiscurve::Table throttleTable;
+  axiscurve::bakeThrottle(0, 1023, 100, -23000.0, &throttleTable);
+  const int value = board->finalValue;
+  const int mixture = static_cast<int>(
+      axiscurve::closedAxis +
+      (axiscurve::openAxis - axiscurve::closedAxis) * (value / 1023.0f));
+
+  board->expected = {
+      {InputEnum::DEFINITION_AXIS_ELEVATOR_SET,
+       axiscurve::lookup(curveTable, value)},
+      {InputEnum::DEFINITION_AXIS_AILERONS_SET,
+       axiscurve::lookup(curveTable, 1023 - value)},
+      {InputEnum::DATA_EX_THROTTLE_1_AXIS,
+       axiscurve::lookup(throttleTable, value)},
+      {InputEnum::DATA_EX_THROTTLE_4_AXIS,
+       axiscurve::lookup(throttleTable, value + 3)},
+      {InputEnum::DEFINITION_MIXTURE_LEVER_AXIS_1, mixture},
+      {InputEnum::DEFINITION_AXIS_RUDDER_SET,
+       axiscurve::lookup(curveTable, value)},
+      {InputEnum::DEFINITION_ELEVATOR_TRIM_SET, value * 4},
+      {InputEnum::DEFINITION_AXIS_LEFT_BRAKE_SET,
+       axiscurve::lookup(curveTable, value)},
+  };
+}
+
+void testHandlersKeepTheirOwnState() {
+  std::vector<Board> boards(handlers);
+  for (int i = 0; i < handlers; i++) {
+    boards[i].index = i;
+    boards[i].finalValue = 700 + i * 40;
+    expect(&boards[i]);
+  }
+
+  std::vector<std::thread> threads;
+  for (auto &board : boards) {
+    threads.emplace_back(run, &board);
+  }
+  for (auto &thread : threads) {
+    thread.join();
+  }
+
+  std::map<std::string, std::map<DWORD, int>> received;
+  for (const auto &event : simconnectstandin::transmittedEvents()) {
+    received[event.connection][event.eventID] = static_cast<int>(event.data);
+  }
+  for (auto &board : boards) {
+    const auto &expected = board.expected;
+    const InputAxisState &state = board.state;
+    const int value = board.finalValue;
+    CHECK(state.mappedEngines[0] ==
+          expected.at(InputEnum::DATA_EX_THROTTLE_1_AXIS));
+    CHECK(state.mappedEngines[3] ==
+          expected.at(InputEnum::DATA_EX_THROTTLE_4_AXIS));
+    CHECK(state.mappedMixture[1] ==
+          expected.at(InputEnum::DEFINITION_MIXTURE_LEVER_AXIS_1));
+    CHECK(state.rudder == expected.at(InputEnum::DEFINITION_AXIS_RUDDER_SET));
+    CHECK(state.trim == value * 4);
+    CHECK(state.leftBrake == state.rightBrake);
+
+    const auto &sent = received["Handler " + std::to_string(board.index)];
+    for (const auto &[eventID, axisValue] : expected) {
+      CHECK(sent.count(eventID) == 1 && sent.at(eventID) == axisValue);
+    }
+    SimConnect_Close(board.handle);
+  }
+}
+
+}  // namespace
+
+int main() {
+  testHandlersKeepTheirOwnState();
+  return testResult();
+}
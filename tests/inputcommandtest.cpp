@@ -0,0 +1,269 @@
+// Edge cases of parseInputCommand, then random lines checked against a
+// reference parser that follows the format description character by
+// character.
+
+#include <Inputs/inputcommand.h>
+
+#include <algorithm>
+#include <climits>
+#include <cstdint>
+#include <random>
+#include <string>
+#include <string_view>
+
+#include "check.h"
+
+namespace {
+
+using namespace std::string_view_literals;
+
+bool sameCommand(const InputCommand &a, const InputCommand &b) {
+  if (a.status != b.status) {
+    return false;
+  }
+  if (a.status != InputCommand::OK) {
+    return true;
+  }
+  if (a.prefix != b.prefix || a.fieldCount != b.fieldCount) {
+    return false;
+  }
+  for (int i = 0; i < a.fieldCount; i++) {
+    if (a.fields[i] != b.fields[i]) {
+      return false;
+    }
+  }
+  return true;
+}
+
+bool isBlank(char c) { return c == ' ' || c == '\t'; }
+bool isDigit(char c) { return c >= '0' && c <= '9'; }
+
+// Reads an optional minus and at least one digit from [*at, last); false
+// when there are no digits or the number doesn't fit an int
+bool referenceNumber(std::string_view line, size_t *at, size_t last,
+                     int *value) {
+  size_t i = *at;
+  const bool negative = i < last && line[i] == '-';
+  if (negative) {
+    i++;
+  }
+  if (i == last || !isDigit(line[i])) {
+    return false;
+  }
+  int64_t magnitude = 0;
+  bool overflow = false;
+  for (; i < last && isDigit(line[i]); i++) {
+    magnitude = magnitude * 10 + (line[i] - '0');
+    if (magnitude > int64_t{INT_MAX} + 1) {
+      overflow = true;
+      magnitude = int64_t{INT_MAX} + 1;
+    }
+  }
+  const int64_t signedValue = negative ? -magnitude : magnitude;
+  if (overflow || signedValue > INT_MAX || signedValue < INT_MIN) {
+    return false;
+  }
+  *value = static_cast<int>(signedValue);
+  *at = i;
+  return true;
+}
+
+InputCommand referenceParse(std::string_view line) {
+  InputCommand command;
+  if (line.size() < 3) {
+    return command;
+  }
+  const size_t prefixEnd = std::min(line.size(), InputCommand::prefixWidth);
+  size_t at = 0;
+  while (at < prefixEnd && isBlank(line[at])) {
+    at++;
+  }
+  if (!referenceNumber(line, &at, prefixEnd, &command.prefix) ||
+      command.prefix < 0 || (at < prefixEnd && !isBlank(line[at]))) {
+    command.status = InputCommand::BAD_PREFIX;
+    return command;
+  }
+
+  while (true) {
+    while (at < line.size() && isBlank(line[at])) {
+      at++;
+    }
+    if (at == line.size()) {
+      break;
+    }
+    if (command.fieldCount == InputCommand::maxFields) {
+      command.status = InputCommand::TOO_MANY_FIELDS;
+      return command;
+    }
+    int &field = command.fields[command.fieldCount];
+    if (!referenceNumber(line, &at, line.size(), &field)) {
+      command.status = InputCommand::BAD_FIELD;
+      return command;
+    }
+    if (at < line.size() && line[at] == '.') {
+      at++;
+      while (at < line.size() && isDigit(line[at])) {
+        at++;
+      }
+    }
+    if (at < line.size() && !isBlank(line[at])) {
+      command.status = InputCommand::BAD_FIELD;
+      return command;
+    }
+    command.fieldCount++;
+  }
+  command.status = InputCommand::OK;
+  return command;
+}
+
+void testWellFormed() {
+  InputCommand command = parseInputCommand("199 512 512 600 600");
+  CHECK(command.isValid());
+  CHECK(command.prefix == 199);
+  CHECK(command.fieldCount == 4);
+  CHECK(command.fields[0] == 512 && command.fields[3] == 600);
+
+  command = parseInputCommand("1500 1");
+  CHECK(command.isValid());
+  CHECK(command.prefix == 1500);
+  CHECK(command.fieldCount == 1 && command.fields[0] == 1);
+
+  command = parseInputCommand("322");
+  CHECK(command.isValid());
+  CHECK(command.prefix == 322 && command.fieldCount == 0);
+}
+
+void testEmptyFields() {
+  CHECK(parseInputCommand("").status == InputCommand::EMPTY);
+  CHECK(parseInputCommand("12").status == InputCommand::EMPTY);
+
+  // Runs of blanks and trailing blanks separate fields without adding any
+  InputCommand command = parseInputCommand("199  512 \t 600   ");
+  CHECK(command.isValid());
+  CHECK(command.fieldCount == 2);
+  CHECK(command.fields[0] == 512 && command.fields[1] == 600);
+
+  command = parseInputCommand("401      ");
+  CHECK(command.isValid());
+  CHECK(command.fieldCount == 0);
+
+  CHECK(parseInputCommand("    ").status == InputCommand::BAD_PREFIX);
+}
+
+void testFieldCount() {
+  InputCommand command = parseInputCommand("199 1 2 3 4 5 6 7 8");
+  CHECK(command.isValid());
+  CHECK(command.fieldCount == InputCommand::maxFields);
+  CHECK(command.fields[7] == 8);
+
+  CHECK(parseInputCommand("199 1 2 3 4 5 6 7 8 9").status ==
+        InputCommand::TOO_MANY_FIELDS);
+  CHECK(parseInputCommand("199 1 2 3 4 5 6 7 8 9 10 11 12 13 14 15").status ==
+        InputCommand::TOO_MANY_FIELDS);
+}
+
+void testLongPrefix() {
+  // The prefix is the first four characters like it always was, a fifth
+  // digit starts the first field
+  InputCommand command = parseInputCommand("12345 6");
+  CHECK(command.isValid());
+  CHECK(command.prefix == 1234);
+  CHECK(command.fieldCount == 2);
+  CHECK(command.fields[0] == 5 && command.fields[1] == 6);
+
+  CHECK(parseInputCommand("12a4 1").status == InputCommand::BAD_PREFIX);
+  CHECK(parseInputCommand("abcd 1").status == InputCommand::BAD_PREFIX);
+  CHECK(parseInputCommand("1.5 1").status == InputCommand::BAD_PREFIX);
+}
+
+void testSigns() {
+  InputCommand command = parseInputCommand("900 -512 -0");
+  CHECK(command.isValid());
+  CHECK(command.fields[0] == -512 && command.fields[1] == 0);
+
+  CHECK(parseInputCommand("-12 1").status == InputCommand::BAD_PREFIX);
+  CHECK(parseInputCommand("+12 1").status == InputCommand::BAD_PREFIX);
+  CHECK(parseInputCommand("900 +5").status == InputCommand::BAD_FIELD);
+  CHECK(parseInputCommand("900 --5").status == InputCommand::BAD_FIELD);
+  CHECK(parseInputCommand("900 -").status == InputCommand::BAD_FIELD);
+  CHECK(parseInputCommand("900 5-").status == InputCommand::BAD_FIELD);
+}
+
+void testOverflow() {
+  InputCommand command = parseInputCommand("900 2147483647 -2147483648");
+  CHECK(command.isValid());
+  CHECK(command.fields[0] == INT_MAX && command.fields[1] == INT_MIN);
+
+  CHECK(parseInputCommand("900 2147483648").status == InputCommand::BAD_FIELD);
+  CHECK(parseInputCommand("900 -2147483649").status ==
+        InputCommand::BAD_FIELD);
+  CHECK(parseInputCommand("900 99999999999999999999").status ==
+        InputCommand::BAD_FIELD);
+}
+
+void testDecimals() {
+  InputCommand command = parseInputCommand("199 12.75 5. -3.5");
+  CHECK(command.isValid());
+  CHECK(command.fields[0] == 12 && command.fields[1] == 5);
+  CHECK(command.fields[2] == -3);
+
+  CHECK(parseInputCommand("199 .5").status == InputCommand::BAD_FIELD);
+  CHECK(parseInputCommand("199 1.2.3").status == InputCommand::BAD_FIELD);
+  CHECK(parseInputCommand("199 1e3").status == InputCommand::BAD_FIELD);
+}
+
+void testEmbeddedNul() {
+  CHECK(parseInputCommand("19\0 5"sv).status == InputCommand::BAD_PREFIX);
+  CHECK(parseInputCommand("\0\0\0\0"sv).status == InputCommand::BAD_PREFIX);
+  CHECK(parseInputCommand("199 5\0 6"sv).status == InputCommand::BAD_FIELD);
+  CHECK(parseInputCommand("199 \0"sv).status == InputCommand::BAD_FIELD);
+}
+
+// Random lines from the characters that matter to the format, so most of
+// them land close to a valid message
+void testRandomLines() {
+  constexpr std::string_view alphabet = "0123456789 \t-+.\0a\xff"sv;
+  std::mt19937 random(1234);
+  std::uniform_int_distribution<size_t> length(0, 40);
+  std::uniform_int_distribution<size_t> character(0, alphabet.size() - 1);
+  std::uniform_int_distribution<int> digitHeavy(0, 3);
+
+  int valid = 0;
+  int mismatches = 0;
+  std::string line;
+  for (int i = 0; i < 200000; i++) {
+    line.clear();
+    const size_t size = length(random);
+    for (size_t j = 0; j < size; j++) {
+      line += digitHeavy(random) == 0 ? alphabet[character(random)]
+                                      : alphabet[character(random) % 11];
+    }
+    const InputCommand parsed = parseInputCommand(line);
+    if (!sameCommand(parsed, referenceParse(line)) && mismatches++ < 5) {
+      std::printf("mismatch on \"%s\"\n", line.c_str());
+    }
+    if (parsed.isValid()) {
+      valid++;
+      CHECK(parsed.prefix >= 0 && parsed.prefix <= 9999);
+      CHECK(parsed.fieldCount <= InputCommand::maxFields);
+    }
+  }
+  CHECK(mismatches == 0);
+  // The generator is only useful while it produces both outcomes
+  CHECK(valid > 1000 && valid < 199000);
+}
+
+}  // namespace
+
+int main() {
+  testWellFormed();
+  testEmptyFields();
+  testFieldCount();
+  testLongPrefix();
+  testSigns();
+  testOverflow();
+  testDecimals();
+  testEmbeddedNul();
+  testRandomLines();
+  return testResult();
+}
@@ -0,0 +1,155 @@
+// Many readers pushing into one InputQueue while the consumer drains it the
+// way the input worker does. Every record carries its producer and a
+// sequence number, so the consumer can check that nothing was lost or
+// duplicated and that each producer's records arrive in the order they
+// were pushed. Built with ThreadSanitizer where it is available.
+
+#include <Inputs/inputqueue.h>
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <thread>
+#include <vector>
+
+#include "check.h"
+
+namespace {
+
+constexpr int producers = 8;
+
+InputRecord makeRecord(int producer, int sequence) {
+  InputRecord record;
+  record.port = static_cast<uint16_t>(producer);
+  record.command.status = InputCommand::OK;
+  record.command.prefix = producer;
+  record.command.fieldCount = 2;
+  record.command.fields[0] = sequence;
+  record.command.fields[1] = sequence ^ 0x5a5a;
+  return record;
+}
+
+// Drains the queue until every producer finished and the queue is empty,
+// checking each record against the producer's last one
+void consume(InputQueue *queue, const std::atomic<int> *running,
+             std::vector<int> *received, bool gapsAllowed) {
+  std::vector<int> next(producers, 0);
+  InputRecord record;
+  while (true) {
+    const bool producing = running->load() > 0;
+    queue->waitForRecords(10);
+    while (queue->pop(&record)) {
+      CHECK(queue->depth() <= InputQueue::capacity);
+      const int producer = record.port;
+      const int sequence = record.command.fields[0];
+      CHECK(producer < producers);
+      CHECK(record.command.prefix == producer);
+      CHECK(record.command.fields[1] == (sequence ^ 0x5a5a));
+      if (gapsAllowed) {
+        CHECK(sequence >= next[producer]);
+      } else {
+        CHECK(sequence == next[producer]);
+      }
+      next[producer] = sequence + 1;
+      (*received)[producer]++;
+    }
+    if (!producing) {
+      break;
+    }
+  }
+}
+
+// Producers retry a full queue, so every record has to arrive
+void testNothingLost() {
+  constexpr int perProducer = 200000;
+  InputQueue queue;
+  std::atomic<int> running{producers};
+  std::vector<int> received(producers, 0);
+
+  std::thread consumer(consume, &queue, &running, &received, false);
+  std::vector<std::thread> threads;
+  for (int producer = 0; producer < producers; producer++) {
+    threads.emplace_back([&, producer] {
+      for (int sequence = 0; sequence < perProducer; sequence++) {
+        const InputRecord record = makeRecord(producer, sequence);
+        while (!queue.push(record)) {
+          std::this_thread::yield();
+        }
+      }
+      running--;
+    });
+  }
+  for (auto &thread : threads) {
+    thread.join();
+  }
+  consumer.join();
+
+  for (int producer = 0; producer < producers; producer++) {
+    CHECK(received[producer] == perProducer);
+  }
+  CHECK(queue.depth() == 0);
+}
+
+// Producers that find the queue full move on like the readers do, every
+// record is either received or counted as dropped
+void testDropsAreCounted() {
+  constexpr int perProducer = 100000;
+  InputQueue queue;
+  std::atomic<int> running{producers};
+  std::vector<int> received(producers, 0);
+  std::atomic<uint64_t> rejected{0};
+
+  std::thread consumer(consume, &queue, &running, &received, true);
+  std::vector<std::thread> threads;
+  for (int producer = 0; producer < producers; producer++) {
+    threads.emplace_back([&, producer] {
+      for (int sequence = 0; sequence < perProducer; sequence++) {
+        if (!queue.push(makeRecord(producer, sequence))) {
+          rejected++;
+        }
+      }
+      running--;
+    });
+  }
+  for (auto &thread : threads) {
+    thread.join();
+  }
+  consumer.join();
+
+  uint64_t total = 0;
+  for (int producer = 0; producer < producers; producer++) {
+    total += received[producer];
+  }
+  CHECK(total + rejected.load() == uint64_t{producers} * perProducer);
+  CHECK(queue.droppedRecords() == rejected.load());
+}
+
+// A consumer asleep in waitForRecords wakes for a push well before its
+// timeout
+void testPushWakesConsumer() {
+  InputQueue queue;
+  std::atomic<bool> woke{false};
+  std::thread consumer([&] {
+    queue.waitForRecords(5000);
+    woke = true;
+  });
+  std::this_thread::sleep_for(std::chrono::milliseconds(50));
+  const auto pushed = std::chrono::steady_clock::now();
+  CHECK(queue.push(makeRecord(0, 0)));
+  consumer.join();
+  CHECK(woke.load());
+  CHECK(std::chrono::steady_clock::now() - pushed < std::chrono::seconds(2));
+
+  InputRecord record;
+  CHECK(queue.pop(&record));
+  CHECK(!queue.pop(&record));
+}
+
+}  // namespace
+
+int main() {
+  testNothingLost();
+  testDropsAreCounted();
+  testPushWakesConsumer();
+  return testResult();
+}
@@ -0,0 +1,114 @@
+// Three workers waiting for a sim that isn't running, the SimConnect
+// stand-in refuses every open. Measures the CPU time the process spends
+// while they wait and checks the retries back off, then lets the sim come
+// up and checks the connection opens.
+
+#include <headers/SimConnectReconnector.h>
+#include <simconnectstandin.h>
+#include <time.h>
+
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+#include <memory>
+#include <thread>
+#include <vector>
+
+#include "check.h"
+
+namespace {
+
+double cpuSeconds() {
+  timespec now;
+  clock_gettime(CLOCK_PROCESS_CPUTIME_ID, &now);
+  return now.tv_sec + now.tv_nsec / 1e9;
+}
+
+struct Worker {
+  explicit Worker(const char *name) : reconnector(name) {}
+
+  SimConnectReconnector reconnector;
+  HANDLE handle = nullptr;
+  bool opened = false;
+  std::atomic<int> idleCalls{0};
+};
+
+// The loop every worker ran before SimConnectReconnector
+double spinningCpuShare(double seconds) {
+  const double cpuBefore = cpuSeconds();
+  const auto start = std::chrono::steady_clock::now();
+  HANDLE handle = nullptr;
+  int attempts = 0;
+  while (std::chrono::steady_clock::now() - start <
+         std::chrono::duration<double>(seconds)) {
+    if (SUCCEEDED(SimConnect_Open(&handle, "Spin", nullptr, 0, nullptr, 0))) {
+      break;
+    }
+    attempts++;
+  }
+  std::printf("spinning loop: %d attempts in %.1f s\n", attempts, seconds);
+  return (cpuSeconds() - cpuBefore) / seconds;
+}
+
+void testIdleWhileSimIsDown() {
+  constexpr double seconds = 3.0;
+  simconnectstandin::refuseOpens(1 << 30);
+
+  std::vector<std::unique_ptr<Worker>> workers;
+  for (const char *name : {"Input", "Output", "Dual"}) {
+    workers.push_back(std::make_unique<Worker>(name));
+  }
+  bool abort = false;
+  const double cpuBefore = cpuSeconds();
+  std::vector<std::thread> threads;
+  for (auto &worker : workers) {
+    threads.emplace_back([worker = worker.get(), &abort] {
+      worker->opened = worker->reconnector.open(
+          &worker->handle, abort, [worker] { worker->idleCalls++; });
+    });
+  }
+  std::this_thread::sleep_for(std::chrono::duration<double>(seconds));
+  abort = true;
+  for (auto &thread : threads) {
+    thread.join();
+  }
+  const double share = (cpuSeconds() - cpuBefore) / seconds;
+
+  std::printf("backing off: %.3f %% CPU for three workers\n", share * 100);
+  CHECK(share < 0.02);
+  for (const auto &worker : workers) {
+    CHECK(!worker->opened);
+    // 250, 500, 1000 and 2000 ms apart plus jitter, five attempts at most
+    // in three seconds
+    CHECK(worker->reconnector.failedAttempts() >= 3);
+    CHECK(worker->reconnector.failedAttempts() <= 5);
+    // Idle work still runs every serialWaitTimeoutMs or so
+    CHECK(worker->idleCalls.load() >= 30);
+  }
+
+  const double spinning = spinningCpuShare(0.5);
+  std::printf("spinning: %.1f %% CPU for one worker\n", spinning * 100);
+}
+
+void testOpensOnceSimIsUp() {
+  simconnectstandin::refuseOpens(2);
+  SimConnectReconnector reconnector("Input");
+  HANDLE handle = nullptr;
+  bool abort = false;
+  const auto start = std::chrono::steady_clock::now();
+  CHECK(reconnector.open(&handle, abort));
+  CHECK(reconnector.failedAttempts() == 2);
+  // Two waits, 250 and 500 ms plus at most a quarter of jitter each
+  const auto waited = std::chrono::steady_clock::now() - start;
+  CHECK(waited >= std::chrono::milliseconds(750));
+  CHECK(waited < std::chrono::milliseconds(1500));
+  SimConnect_Close(handle);
+}
+
+}  // namespace
+
+int main() {
+  testIdleWhileSimIsDown();
+  testOpensOnceSimIsUp();
+  return testResult();
+}